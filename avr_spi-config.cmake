@@ -0,0 +1,3 @@
+set(AVR_SPI_SOURCES
+    ${CMAKE_CURRENT_LIST_DIR}/src/avr/spi.cpp
+)
@@ -0,0 +1,622 @@
+//
+// Graphics render benchmark
+//
+// Runs a fixed workload through a statically dispatched page display (the same fast paths as `Ssd1306Display`) and
+// through the generic per-pixel path of the virtual `RasterDisplay` interface, then sends frames through the SSD1306
+// driver with each update policy. Builds for the ATmega328p (run on hardware or under simavr) and for the host:
+//
+//   c++ -std=c++14 -O2 -Iinclude examples/avr/gfx_benchmark/main.cpp -o gfx_benchmark
+//
+// Each measurement is printed as a CSV line:
+//
+//   bench,<platform>,<primitive>,<dispatch>,<time>,<fb_bytes>,<bus_bytes>,<checksum>
+//
+// time      - CPU cycles on AVR (Timer 1, no prescaler), nanoseconds on the host (best of REPEAT runs)
+// fb_bytes  - framebuffer bytes changed by a drawing primitive, or sent to the panel by an update. 0 for rows that do
+//             not use the framebuffer
+// bus_bytes - I2C bytes (address, control, command and data) sent by an update
+// checksum  - CRC-16 (CCITT) of the framebuffer. Static and virtual rows of a primitive must match. `-` for rows that
+//             do not use the framebuffer
+//
+// The bus is a null I2C interface, so update times are the CPU cost of the policy without the bus transfer time
+// (bus_bytes * 9 bit periods). scripts/run_benchmark.py collects the output and compares it against a baseline.
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#if defined(__AVR__)
+#include <avr/io.h>
+#include <avr/interrupt.h>
+
+#include <ftl/logging/logger.hpp>
+#include <ftl/comms/uart.hpp>
+#include <ftl/platform/platform.hpp>
+#include <ftl/platform/avr/interfaces/timer.hpp>
+
+using namespace ftl::logging;
+using namespace ftl::platform;
+#else
+#include <time.h>
+#endif
+
+#include <ftl/comms/i2c.hpp>
+#include <ftl/comms/i2c/counting_i2c.hpp>
+#include <ftl/drivers/displays/ssd1306.hpp>
+#include <ftl/drivers/displays/ssd1306_transport.hpp>
+#include <ftl/gfx/display.hpp>
+#include <ftl/gfx/fonts/basic_font.hpp>
+#include <ftl/gfx/fonts/basic_prop_font.hpp>
+#include <ftl/gfx/page_display.hpp>
+#include <ftl/gfx/page_framebuffer.hpp>
+#include <ftl/gfx/rect.hpp>
+#include <ftl/gfx/text_console.hpp>
+#include <ftl/gfx/update_policy.hpp>
+#include <ftl/memory/memreader.hpp>
+
+#define DISPLAY_WIDTH 128
+#define DISPLAY_HEIGHT 32
+#define DISPLAY_PAGES (DISPLAY_HEIGHT / 8)
+
+// Workload suites. The fonts, the framebuffer and the diff update shadow do not all fit in the 2 KB of SRAM of the
+// ATmega328p, so each AVR image runs a subset selected with BENCHMARK_SUITES (see CMakeLists.txt)
+#define SUITE_SHAPES    0x01
+#define SUITE_TEXT      0x02
+#define SUITE_PROP_TEXT 0x04
+#define SUITE_UPDATE    0x08
+#define SUITE_DRAW      (SUITE_SHAPES | SUITE_TEXT | SUITE_PROP_TEXT)
+
+#ifndef BENCHMARK_SUITES
+#if defined(__AVR__)
+#define BENCHMARK_SUITES (SUITE_SHAPES | SUITE_TEXT)
+#else
+#define BENCHMARK_SUITES (SUITE_SHAPES | SUITE_TEXT | SUITE_PROP_TEXT | SUITE_UPDATE)
+#endif
+#endif
+
+// Glyphs drawn by the drawChar workload (a grid of 8x8 cells)
+#define NUM_GLYPHS ((DISPLAY_WIDTH / 8) * (DISPLAY_HEIGHT / 8))
+
+#if defined(__AVR__)
+#define PLATFORM "avr"
+#define TIME_UNIT "cycles"
+#define REPEAT 1
+#define REPORT(fmt, ...) LOG_INFO(fmt, ##__VA_ARGS__)
+#else
+#define PLATFORM "host"
+#define TIME_UNIT "ns"
+#define REPEAT 50
+#define REPORT(fmt, ...) printf(fmt "\n", ##__VA_ARGS__)
+#endif
+
+// 16x16 XBITMAP test pattern
+static const uint8_t sprite_bits[] = {
+   0xff, 0xff, 0x01, 0x80, 0xfd, 0xbf, 0x05, 0xa0, 0xf5, 0xaf, 0x15, 0xa8,
+   0xd5, 0xab, 0x55, 0xaa, 0x55, 0xaa, 0xd5, 0xab, 0x15, 0xa8, 0xf5, 0xaf,
+   0x05, 0xa0, 0xfd, 0xbf, 0x01, 0x80, 0xff, 0xff };
+
+using FrameBuffer = ftl::gfx::PageFrameBuffer<DISPLAY_WIDTH, DISPLAY_PAGES>;
+
+// Shared page framebuffer. Both displays render into the same memory so the workload fits in SRAM.
+static FrameBuffer framebuffer;
+
+/**
+ * I2C interface that discards everything. Stands in for the bus so updates can be counted without a panel attached
+*/
+class NullI2C
+{
+public:
+    static void initialize(ftl::comms::i2c::ClockMode)
+    {
+    }
+
+    void begin(uint8_t, ftl::comms::i2c::SlaMode)
+    {
+    }
+
+    void stop()
+    {
+    }
+
+    void write(uint8_t)
+    {
+    }
+
+    uint8_t read(bool)
+    {
+        return 0;
+    }
+};
+
+using Bus = ftl::comms::i2c::CountingI2C<NullI2C>;
+using Driver = ftl::drivers::Ssd1306<ftl::drivers::Ssd1306I2C<Bus>, DISPLAY_HEIGHT>;
+
+/**
+ * Page display using static dispatch, with the byte-wise span and glyph paths
+*/
+class StaticFramebufferDisplay
+    : public ftl::gfx::PageRasterDisplay<StaticFramebufferDisplay, FrameBuffer&, ftl::memory::DefaultMemoryReader>
+{
+public:
+    StaticFramebufferDisplay()
+        : ftl::gfx::PageRasterDisplay<StaticFramebufferDisplay, FrameBuffer&, ftl::memory::DefaultMemoryReader>{
+              DISPLAY_WIDTH, DISPLAY_HEIGHT, framebuffer}
+    {
+    }
+
+    void update()
+    {
+    }
+};
+
+/**
+ * Framebuffer display using virtual dispatch and the generic per-pixel primitives
+*/
+class VirtualFramebufferDisplay : public ftl::gfx::RasterDisplay<>
+{
+public:
+    VirtualFramebufferDisplay() : ftl::gfx::RasterDisplay<>{DISPLAY_WIDTH, DISPLAY_HEIGHT}
+    {
+    }
+
+    void drawPixel(unsigned int col, unsigned int row, const ftl::gfx::Color& c) override
+    {
+        if (!clip().contains(col, row)) return;
+        framebuffer.setPixel(col, row, c.monochrome());
+    }
+
+    void update() override
+    {
+    }
+};
+
+#if defined(__AVR__)
+
+static void timerStart()
+{
+    // Timer 1, normal mode, no prescaler. Overflows are counted by the avr_timer support library
+    TCCR1A = 0;
+    TCCR1B = 0;
+    TCNT1 = 0;
+    ftl::resetTimerOverflow();
+    TIFR1 = BV(TOV1);
+    TIMSK1 = BV(TOIE1);
+    TCCR1B = BV(CS10);
+}
+
+static uint32_t timerStop()
+{
+    TCCR1B = 0;
+    return (static_cast<uint32_t>(ftl::timerOverflow()) << 16) | TCNT1;
+}
+
+#else
+
+static uint64_t now()
+{
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000ULL + ts.tv_nsec;
+}
+
+static uint64_t start_time;
+
+static void timerStart()
+{
+    start_time = now();
+}
+
+static uint32_t timerStop()
+{
+    return static_cast<uint32_t>(now() - start_time);
+}
+
+#endif
+
+/**
+ * CRC-16 (CCITT, polynomial 0x1021, initial value 0xFFFF) of the framebuffer.
+ *
+ * Unlike a modulo 255 sum, 0xFF and 0x00 bytes give different results, so a framebuffer of set bytes never checksums
+ * the same as a blank one.
+*/
+static uint16_t framebufferChecksum()
+{
+    uint16_t crc = 0xFFFF;
+
+    const auto* data = framebuffer.data();
+    for (auto i = 0u; i < framebuffer.size(); ++i)
+    {
+        crc ^= static_cast<uint16_t>(data[i]) << 8;
+
+        for (auto bit = 0u; bit < 8; ++bit)
+        {
+            crc = (crc & 0x8000) ? static_cast<uint16_t>((crc << 1) ^ 0x1021) : static_cast<uint16_t>(crc << 1);
+        }
+    }
+
+    return crc;
+}
+
+/**
+ * Framebuffer bytes changed by `run` after `setup`.
+ *
+ * A copy of the whole framebuffer does not fit next to the fonts in the SRAM of the ATmega328p, so the workload is
+ * run once per page and only that page is compared against its snapshot.
+*/
+template<class Setup, class Run>
+static unsigned int framebufferBytesChanged(Setup setup, Run run)
+{
+    static uint8_t snapshot[DISPLAY_WIDTH];
+    unsigned int n = 0;
+
+    for (auto p = 0u; p < DISPLAY_PAGES; ++p)
+    {
+        setup();
+        memcpy(snapshot, framebuffer.page(p), DISPLAY_WIDTH);
+        run();
+
+        const auto* page = framebuffer.page(p);
+        for (auto x = 0u; x < DISPLAY_WIDTH; ++x)
+        {
+            n += page[x] != snapshot[x];
+        }
+    }
+
+    return n;
+}
+
+/**
+ * Best time (of REPEAT runs) and bus bytes of a workload
+*/
+struct Measurement
+{
+    uint32_t time;
+    unsigned long bus_bytes;
+};
+
+/**
+ * Time `run` after `setup`, which is not timed
+*/
+template<class Setup, class Run>
+static Measurement measure(Setup setup, Run run)
+{
+    Measurement m{0xFFFFFFFFUL, 0};
+
+    for (auto i = 0u; i < REPEAT; ++i)
+    {
+        setup();
+        Bus::reset();
+
+        timerStart();
+        run();
+        const auto t = timerStop();
+
+        if (t < m.time) m.time = t;
+        m.bus_bytes = Bus::bytes();
+    }
+
+    return m;
+}
+
+/**
+ * Report one CSV line. The framebuffer checksum is only reported for rows that use the framebuffer
+*/
+static void report(const char* primitive, const char* dispatch, const Measurement& m, unsigned int fb_bytes,
+                   bool checksum)
+{
+    if (checksum)
+    {
+        REPORT("bench," PLATFORM ",%s,%s,%lu,%u,%lu,%04x", primitive, dispatch, static_cast<unsigned long>(m.time),
+               fb_bytes, m.bus_bytes, framebufferChecksum());
+    }
+    else
+    {
+        REPORT("bench," PLATFORM ",%s,%s,%lu,%u,%lu,-", primitive, dispatch, static_cast<unsigned long>(m.time),
+               fb_bytes, m.bus_bytes);
+    }
+}
+
+/**
+ * Time a drawing primitive on a cleared framebuffer and report the bytes it changed
+*/
+template<class Run>
+static void measure(const char* primitive, const char* dispatch, Run run)
+{
+    const auto setup = [] { framebuffer.clear(); };
+
+    const auto m = measure(setup, run);
+    const auto changed = framebufferBytesChanged(setup, run);
+
+    report(primitive, dispatch, m, changed, true);
+}
+
+#if (BENCHMARK_SUITES) & SUITE_TEXT
+
+/**
+ * Console flush of two changed cells with one clean cell between them. They are sent in a single address window, so
+ * bus_bytes goes up if the runs stop being merged
+*/
+static void consoleWorkload()
+{
+    static Driver driver{0x3C};
+    static ftl::gfx::TextConsole<Driver, DISPLAY_WIDTH / 8, DISPLAY_PAGES> console{driver,
+                                                                                  &ftl::gfx::fonts::BASIC_FONT};
+
+    const auto m = measure([&] {
+        console.clear();
+        console.flush();
+        console.setCell(0, 1, 'A', console.ATTR_NONE);
+        console.setCell(2, 1, 'B', console.ATTR_NONE);
+    }, [&] {
+        console.flush();
+    });
+
+    // The console renders straight to the panel, the framebuffer is not used
+    report("console_gap", "static", m, 0, false);
+}
+
+#endif
+
+#if (BENCHMARK_SUITES) & SUITE_DRAW
+
+/**
+ * Drawing workload. Every primitive starts from a cleared framebuffer
+*/
+template<class DisplayT>
+static void drawWorkload(DisplayT& display, const char* dispatch)
+{
+    const auto white = ftl::gfx::Color::white();
+
+#if (BENCHMARK_SUITES) & SUITE_SHAPES
+    measure("lines", dispatch, [&] {
+        // From the centre to points around the edge, covering all eight octants
+        const int xc = DISPLAY_WIDTH / 2;
+        const int yc = DISPLAY_HEIGHT / 2;
+
+        for (int x = 0; x < DISPLAY_WIDTH; x += 16)
+        {
+            display.drawLine(xc, yc, x, 0, white);
+            display.drawLine(xc, yc, DISPLAY_WIDTH - 1 - x, DISPLAY_HEIGHT - 1, white);
+        }
+        for (int y = 0; y < DISPLAY_HEIGHT; y += 8)
+        {
+            display.drawLine(xc, yc, 0, DISPLAY_HEIGHT - 1 - y, white);
+            display.drawLine(xc, yc, DISPLAY_WIDTH - 1, y, white);
+        }
+    });
+
+    measure("long_line", dispatch, [&] {
+        // Mostly off screen. Long enough that the error term needs more than 16 bits
+        display.drawLine(-8000, -8000, 8000, 8000, white);
+        display.drawLine(11, 30, 15280, -4469, white);
+    });
+
+    measure("hline", dispatch, [&] {
+        for (int y = 0; y < DISPLAY_HEIGHT; y += 2)
+        {
+            display.drawHLine(0, y, DISPLAY_WIDTH - 1, white);
+        }
+    });
+
+    measure("vline", dispatch, [&] {
+        for (int x = 0; x < DISPLAY_WIDTH; x += 2)
+        {
+            display.drawVLine(x, 0, DISPLAY_HEIGHT - 1, white);
+        }
+    });
+
+    measure("rect", dispatch, [&] {
+        display.drawRect(4, 4, DISPLAY_WIDTH - 9, DISPLAY_HEIGHT - 9, white);
+    });
+
+    measure("fill_rect", dispatch, [&] {
+        display.drawFillRect(3, 5, DISPLAY_WIDTH - 7, DISPLAY_HEIGHT - 12, white);
+    });
+
+    measure("circle", dispatch, [&] {
+        for (int r = 4; r < DISPLAY_HEIGHT / 2; r += 4)
+        {
+            display.drawCircle(DISPLAY_WIDTH / 2, DISPLAY_HEIGHT / 2, r, white);
+        }
+    });
+
+    measure("fill_circle", dispatch, [&] {
+        display.drawFillCircle(DISPLAY_WIDTH / 2, DISPLAY_HEIGHT / 2, DISPLAY_HEIGHT / 2 - 1, white);
+    });
+
+    measure("xbitmap", dispatch, [&] {
+        for (int x = 0; x < DISPLAY_WIDTH; x += 16)
+        {
+            // Alternate between page aligned and unaligned rows
+            display.drawXBitmap(sprite_bits, x, (x & 16) ? 8 : 5, 16, 16, white);
+        }
+    });
+
+#endif
+
+#if (BENCHMARK_SUITES) & SUITE_TEXT
+    display.setFont(&ftl::gfx::fonts::BASIC_FONT);
+
+    measure("char", dispatch, [&] {
+        for (int i = 0; i < NUM_GLYPHS; ++i)
+        {
+            display.drawChar('!' + i, (i % (DISPLAY_WIDTH / 8)) * 8, (i / (DISPLAY_WIDTH / 8)) * 8, white);
+        }
+    });
+
+    measure("scaled_string", dispatch, [&] {
+        display.drawScaledString("Scale x2", 0, 4, 2, white);
+    });
+
+#endif
+
+#if (BENCHMARK_SUITES) & SUITE_PROP_TEXT
+    display.setFont(&ftl::gfx::fonts::BASIC_PROP_FONT);
+
+    measure("prop_string", dispatch, [&] {
+        display.drawString("The quick brown fox", 0, 0, white);
+        display.drawString("jumps over the", 0, 8, white);
+        display.drawString("lazy dog 0123456789", 0, 19, white);
+    });
+#endif
+}
+
+#endif
+
+#if (BENCHMARK_SUITES) & SUITE_UPDATE
+
+/**
+ * Frame used by the update workload
+*/
+static void drawScene(StaticFramebufferDisplay& display)
+{
+    const auto white = ftl::gfx::Color::white();
+
+    framebuffer.clear();
+    display.drawRect(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT, white);
+    display.drawFillRect(4, 4, 40, 8, white);
+    display.drawFillCircle(100, 16, 10, white);
+    display.drawXBitmap(sprite_bits, 60, 12, 16, 16, white);
+}
+
+/**
+ * Driver wrapper that counts the framebuffer bytes an update policy sends to the panel
+*/
+class PanelCounter
+{
+public:
+    explicit PanelCounter(Driver& driver)
+        : driver_(driver)
+        , bytes_{0}
+    {
+    }
+
+    void setWindow(uint8_t col_start, uint8_t col_end, uint8_t page_start, uint8_t page_end)
+    {
+        driver_.setWindow(col_start, col_end, page_start, page_end);
+    }
+
+    void sendBuffer(const uint8_t* buffer, unsigned int length)
+    {
+        bytes_ += length;
+        driver_.sendBuffer(buffer, length);
+    }
+
+    void beginData()
+    {
+        driver_.beginData();
+    }
+
+    void writeData(const uint8_t* buffer, unsigned int length)
+    {
+        bytes_ += length;
+        driver_.writeData(buffer, length);
+    }
+
+    void endData()
+    {
+        driver_.endData();
+    }
+
+    unsigned int bytes() const
+    {
+        return bytes_;
+    }
+
+    void reset()
+    {
+        bytes_ = 0;
+    }
+
+private:
+    Driver& driver_;
+    unsigned int bytes_;
+};
+
+/**
+ * Update workload. Sends the scene through the SSD1306 driver with each update policy
+*/
+static void updateWorkload(StaticFramebufferDisplay& display)
+{
+    static Driver driver{0x3C};
+    PanelCounter panel{driver};
+
+    ftl::gfx::FullUpdate::Updater<DISPLAY_WIDTH, DISPLAY_PAGES> full;
+    const ftl::gfx::Rect area{32, 8, 95, 23};
+
+    auto m = measure([&] {
+        drawScene(display);
+        panel.reset();
+    }, [&] {
+        full.update(panel, framebuffer);
+    });
+    report("full_update", "static", m, panel.bytes(), true);
+
+    m = measure([&] {
+        drawScene(display);
+        panel.reset();
+    }, [&] {
+        full.update(panel, framebuffer, area);
+    });
+    report("region_update", "static", m, panel.bytes(), true);
+
+    // The shadow costs another framebuffer worth of SRAM
+    static ftl::gfx::DiffUpdate<>::Updater<DISPLAY_WIDTH, DISPLAY_PAGES> diff;
+
+    // Panel shows the scene, then a bar and the sprite change
+    m = measure([&] {
+        drawScene(display);
+        diff.update(panel, framebuffer);
+        display.drawFillRect(24, 4, 20, 8, ftl::gfx::Color::black());
+        display.drawXBitmap(sprite_bits, 62, 12, 16, 16, ftl::gfx::Color::white());
+        panel.reset();
+    }, [&] {
+        diff.update(panel, framebuffer);
+    });
+    report("diff_update", "static", m, panel.bytes(), true);
+}
+
+#endif
+
+int main()
+{
+#if defined(__AVR__)
+    Logger<Hardware::UART0> logger{ftl::comms::uart::BaudRate::Rate_9600};
+    SystemLogger::instance().setLogger(&logger);
+
+    sei();
+#endif
+
+    StaticFramebufferDisplay static_display;
+
+    REPORT("bench,platform,primitive,dispatch," TIME_UNIT ",fb_bytes,bus_bytes,checksum");
+
+#if (BENCHMARK_SUITES) & SUITE_DRAW
+    VirtualFramebufferDisplay virtual_display;
+
+    drawWorkload(static_display, "static");
+    drawWorkload<ftl::gfx::RasterDisplay<>>(virtual_display, "virtual");
+#endif
+
+#if (BENCHMARK_SUITES) & SUITE_TEXT
+    consoleWorkload();
+#endif
+
+#if (BENCHMARK_SUITES) & SUITE_UPDATE
+    updateWorkload(static_display);
+#endif
+
+    REPORT("bench_done");
+
+#if defined(__AVR__)
+    for(;;)
+    {
+    }
+#endif
+
+    return 0;
+}
@@ -0,0 +1,49 @@
+//
+// Two PCA9685 boards driven as one 32 channel bank
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+
+#include <stdint.h>
+
+#include <ftl/drivers/pwm/pca9685_array.hpp>
+
+#include <ftl/platform/platform.hpp>
+
+using namespace ftl::drivers;
+using namespace ftl::platform;
+
+int main()
+{
+    Hardware::I2C0::initialize(ftl::comms::i2c::ClockMode::Fast);
+
+    // Neither board may sit on the All Call address (0x70)
+    Pca9685Array<Hardware::I2C0, 2> pwm{0x40, 0x41};
+
+    pwm.initialize();
+    pwm.setFrequency(200.0f);
+    pwm.enable(true);
+
+    // Every channel off in one broadcast
+    pwm.setAll(0, 4096);
+
+    uint16_t phase = 0;
+
+    for(;;)
+    {
+        // A brightness ramp travelling along all 32 channels, latched on both boards at once
+        for (auto c = 0u; c < pwm.size(); ++c)
+        {
+            const uint16_t level = ((c * 128u) + phase) & 0x0FFF;
+            pwm.stage(c, 0, level);
+        }
+
+        pwm.commit();
+
+        phase += 64;
+        Hardware::Timer::delayMs(20);
+    }
+
+    return 0;
+}
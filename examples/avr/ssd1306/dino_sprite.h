@@ -0,0 +1,22 @@
+#ifndef DINO_SPRITE_H
+#define DINO_SPRITE_H
+
+#include <stdint.h>
+#include <ftl/memory/flash.hpp>
+
+#define dino_sprite_width 40
+#define dino_sprite_height 43
+
+static const uint8_t dino_sprite[] FTL_FLASH = {
+    0x28, 0x2b, 0x13, 0x85, 0xfc, 0xfc, 0xff, 0xff, 0xe7, 0xe7, 0x4b, 0xff,
+    0x81, 0xfc, 0xfc, 0x81, 0x80, 0x80, 0x0f, 0x81, 0x80, 0x80, 0x47, 0xff,
+    0x81, 0x7f, 0x7f, 0x45, 0x67, 0x43, 0x07, 0x85, 0xff, 0xff, 0xf8, 0xf8,
+    0xe0, 0xe0, 0x43, 0x80, 0x81, 0xe0, 0xe0, 0x42, 0xf8, 0x42, 0xfe, 0x49,
+    0xff, 0x83, 0x18, 0x18, 0x78, 0x78, 0x07, 0x85, 0x07, 0x07, 0x1f, 0x1f,
+    0x7f, 0x7f, 0x51, 0xff, 0x83, 0x7f, 0x7f, 0x0f, 0x0f, 0x0b, 0x05, 0x91,
+    0x01, 0x01, 0x07, 0x07, 0xff, 0xff, 0x7f, 0x7f, 0x1f, 0x1f, 0x07, 0x07,
+    0x1f, 0x1f, 0xff, 0xff, 0x01, 0x01, 0x0f, 0x09, 0x83, 0x07, 0x07, 0x06,
+    0x06, 0x05, 0x83, 0x07, 0x07, 0x06, 0x06, 0x0f,
+};
+
+#endif
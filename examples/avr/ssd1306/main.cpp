@@ -14,14 +14,15 @@
 
 #include <ftl/drivers/displays/ssd1306.hpp>
 #include <ftl/gfx/adaptors/ssd1306_display.hpp>
+#include <ftl/gfx/fonts/basic_prop_font.hpp>
+#include <ftl/memory/flash.hpp>
 
 #include <ftl/platform/platform.hpp>
 
-// XBITMAP sprites
-#include "dino.h"
+// Generated from dino.h with scripts/xbm2sprite.py --flash
+#include "dino_sprite.h"
 
 #define OLED_ADDRESS 0x3C
-#define DISPLAY_HEIGHT 64
 
 using namespace ftl::drivers;
 using namespace ftl::logging;
@@ -34,7 +35,8 @@ int main()
 
     Hardware::I2C0::initialize(ftl::comms::i2c::ClockMode::Fast);
 
-    ftl::gfx::Ssd1306Display<Hardware::I2C0> display{OLED_ADDRESS, DISPLAY_HEIGHT};
+    // The sprite and font are read from flash
+    ftl::gfx::Ssd1306Display<Ssd1306I2C<Hardware::I2C0>, ftl::memory::FlashReader> display{OLED_ADDRESS};
     if (display.initialize())
     {
         LOG_INFO("OLED init complete");
@@ -45,7 +47,9 @@ int main()
     }
 
     display.clear();
-    display.drawXBitmap(dino_bits, 0, 20, dino_width, dino_height, ftl::gfx::Color::white());
+    display.drawSprite(dino_sprite, 0, 20, ftl::gfx::Color::white());
+    display.setFont(&ftl::gfx::fonts::BASIC_PROP_FLASH_FONT);
+    display.drawString("Proportional text", 0, 0, ftl::gfx::Color::white());
     display.update();
 
     // Enable hardware scrolling
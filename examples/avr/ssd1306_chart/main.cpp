@@ -0,0 +1,65 @@
+//
+// Live MCP9600 temperature chart on SSD1306
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <ftl/comms/i2c/i2c_device.hpp>
+#include <ftl/drivers/sensors/mcp9600.hpp>
+
+#include <ftl/drivers/displays/ssd1306.hpp>
+#include <ftl/drivers/displays/ssd1306_transport.hpp>
+#include <ftl/gfx/strip_chart.hpp>
+#include <ftl/gfx/text_console.hpp>
+#include <ftl/gfx/fonts/basic_font.hpp>
+#include <ftl/memory/flash.hpp>
+#include <ftl/platform/platform.hpp>
+
+#define OLED_ADDRESS 0x3C
+#define MCP9600_ADDRESS 0x67
+
+using namespace ftl::drivers;
+using namespace ftl::gfx;
+using namespace ftl::platform;
+
+using Driver = Ssd1306<Ssd1306I2C<Hardware::I2C0>>;
+
+int main()
+{
+    Hardware::I2C0::initialize(ftl::comms::i2c::ClockMode::Fast);
+
+    Driver driver{OLED_ADDRESS};
+    driver.initialize();
+
+    sensors::Mcp9600<Hardware::I2C0> mcp{MCP9600_ADDRESS};
+    mcp.verify();
+
+    // Readout on the top page, chart on the other seven
+    TextConsole<Driver, 16, 1, ftl::memory::FlashReader> header{driver, &fonts::BASIC_PAGE_FONT};
+    header.initialize();
+
+    StripChart<Driver, 7> chart{driver, 0, Driver::WIDTH, 1};
+    chart.setRange(0, 100);
+    chart.clear();
+
+    char buf[17];
+
+    for(;;)
+    {
+        const auto hot = (int)mcp.readThermocouple();
+
+        snprintf(buf, sizeof(buf), "temp: %4d C", hot);
+        header.print(0, 0, buf);
+        header.flush();
+
+        chart.plot(hot);
+
+        Hardware::Timer::delayMs(100);
+    }
+
+    return 0;
+}
@@ -0,0 +1,63 @@
+//
+// Text console dashboard on SSD1306
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <ftl/comms/i2c/i2c_device.hpp>
+
+#include <ftl/drivers/displays/ssd1306.hpp>
+#include <ftl/drivers/displays/ssd1306_transport.hpp>
+#include <ftl/gfx/text_console.hpp>
+#include <ftl/gfx/fonts/basic_font.hpp>
+#include <ftl/memory/flash.hpp>
+#include <ftl/platform/platform.hpp>
+
+#define OLED_ADDRESS 0x3C
+
+using namespace ftl::drivers;
+using namespace ftl::gfx;
+using namespace ftl::platform;
+
+using Driver = Ssd1306<Ssd1306I2C<Hardware::I2C0>>;
+using Console = TextConsole<Driver, 16, 8, ftl::memory::FlashReader>;
+
+int main()
+{
+    Hardware::I2C0::initialize(ftl::comms::i2c::ClockMode::Fast);
+
+    Driver driver{OLED_ADDRESS};
+    driver.initialize();
+
+    Console console{driver, &fonts::BASIC_PAGE_FONT};
+    console.initialize();
+
+    console.print(0, 0, "   FTL CONSOLE  ", Console::ATTR_INVERSE);
+    console.print(0, 2, "count:");
+    console.print(0, 3, "uptime:");
+
+    unsigned int count = 0;
+    unsigned int ticks = 0;
+    char buf[Console::NUM_COLS + 1];
+
+    for(;;)
+    {
+        // Only the digits that changed are sent
+        snprintf(buf, sizeof(buf), "%5u", count++);
+        console.print(8, 2, buf);
+
+        snprintf(buf, sizeof(buf), "%5us", ticks / 10);
+        console.print(8, 3, buf);
+
+        console.flush();
+
+        Hardware::Timer::delayMs(100);
+        ticks++;
+    }
+
+    return 0;
+}
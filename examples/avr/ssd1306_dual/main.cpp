@@ -0,0 +1,60 @@
+//
+// Two SSD1306 panels on one I2C bus sharing a single page buffer
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <ftl/drivers/displays/ssd1306_transport.hpp>
+#include <ftl/gfx/adaptors/ssd1306_panel_group.hpp>
+#include <ftl/gfx/fonts/basic_prop_font.hpp>
+#include <ftl/platform/platform.hpp>
+
+#define LEFT_ADDRESS 0x3C
+#define RIGHT_ADDRESS 0x3D
+
+using namespace ftl::drivers;
+using namespace ftl::gfx;
+using namespace ftl::platform;
+
+using Panel = Ssd1306StreamPanel<Ssd1306I2C<Hardware::I2C0>>;
+
+int main()
+{
+    Hardware::I2C0::initialize(ftl::comms::i2c::ClockMode::Fast);
+
+    // One 128 byte page buffer for both panels, instead of a 1 KB framebuffer each
+    Panel::PageBuffer page;
+    Panel left{page, LEFT_ADDRESS};
+    Panel right{page, RIGHT_ADDRESS};
+
+    Ssd1306PanelGroup<Panel, 2> panels{left, right};
+    panels.initialize();
+
+    left.setFont(&fonts::BASIC_PROP_FONT);
+    right.setFont(&fonts::BASIC_PROP_FONT);
+
+    char count_str[8];
+    unsigned int count = 0;
+
+    for(;;)
+    {
+        snprintf(count_str, sizeof(count_str), "%u", count++);
+
+        left.clear();
+        left.drawString("Left panel", 0, 0, Color::white());
+        left.drawScaledString(count_str, 0, 24, 3, Color::white());
+
+        right.clear();
+        right.drawString("Right panel", 0, 0, Color::white());
+        right.drawFillRect(0, 24, count % 128, 16, Color::white());
+        right.drawRect(0, 24, 127, 16, Color::white());
+
+        panels.update();
+    }
+
+    return 0;
+}
@@ -15,10 +15,10 @@
 #include <ftl/gfx/adaptors/ssd1306_display.hpp>
 #include <ftl/logging/adaptors/display_adaptor.hpp>
 #include <ftl/gfx/fonts/basic_font.hpp>
+#include <ftl/memory/flash.hpp>
 #include <ftl/platform/platform.hpp>
 
 #define OLED_ADDRESS 0x3C
-#define DISPLAY_HEIGHT 64
 
 using namespace ftl::drivers;
 using namespace ftl::logging;
@@ -28,8 +28,8 @@ int main()
 {
     Hardware::I2C0::initialize(ftl::comms::i2c::ClockMode::Fast);
 
-    Logger<RasterDisplayLoggerAdaptor<ftl::gfx::Ssd1306Display<Hardware::I2C0>>> logger{OLED_ADDRESS, DISPLAY_HEIGHT};
-    logger.getOutput().getDisplay().setFont(&ftl::gfx::fonts::BASIC_FONT);
+    Logger<RasterDisplayLoggerAdaptor<ftl::gfx::Ssd1306Display<Ssd1306I2C<Hardware::I2C0>, ftl::memory::FlashReader>>> logger{OLED_ADDRESS};
+    logger.getOutput().getDisplay().setFont(&ftl::gfx::fonts::BASIC_PAGE_FONT);
 
     SystemLogger::instance().setLogger(&logger);
 
@@ -0,0 +1,72 @@
+//
+// SSD1306 over 4-wire SPI
+//
+// Wiring (ATmega328p): SCK PB5, MOSI PB3, CS PB2, D/C PB1, RES PB0
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+
+#include <avr/io.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include <ftl/logging/logger.hpp>
+#include <ftl/comms/uart.hpp>
+
+#include <ftl/drivers/displays/ssd1306.hpp>
+#include <ftl/gfx/adaptors/ssd1306_display.hpp>
+#include <ftl/memory/flash.hpp>
+
+#include <ftl/platform/platform.hpp>
+#include <ftl/utils/bitutil.hpp>
+
+// Generated with scripts/xbm2sprite.py --flash
+#include "dino_sprite.h"
+
+using namespace ftl::drivers;
+using namespace ftl::logging;
+using namespace ftl::platform;
+
+using OledTransport = Ssd1306Spi<Hardware::SPI0, Hardware::GPIOB<2>, Hardware::GPIOB<1>>;
+
+int main()
+{
+    Logger<Hardware::UART0> logger{ftl::comms::uart::BaudRate::Rate_9600};
+    SystemLogger::instance().setLogger(&logger);
+
+    Hardware::SPI0::initialize(ftl::comms::spi::ClockDivider::Div2);
+
+    // Pulse the panel reset line
+    Hardware::GPIOB<0> reset{ftl::GpioState::Output};
+    reset.reset();
+    Hardware::Timer::delayMs(1);
+    reset.set();
+
+    // The sprite is read from flash
+    ftl::gfx::Ssd1306Display<OledTransport, ftl::memory::FlashReader> display;
+    display.initialize();
+    LOG_INFO("OLED init complete");
+
+    // Timer 1, normal mode, 64 prescaler (4us per tick)
+    TCCR1A = 0;
+    TCCR1B = BV(CS11) | BV(CS10);
+
+    int x = 0;
+
+    for(;;)
+    {
+        display.clear();
+        display.drawSprite(dino_sprite, x, 20, ftl::gfx::Color::white());
+
+        TCNT1 = 0;
+        display.update();
+        const uint16_t ticks = TCNT1;
+
+        LOG_INFO("frame sent in %u us", ticks * 4u);
+
+        x = (x + 4) % (display.width() - dino_sprite_width);
+    }
+
+    return 0;
+}
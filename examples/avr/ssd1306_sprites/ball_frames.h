@@ -0,0 +1,16 @@
+#ifndef BALL_FRAMES_H
+#define BALL_FRAMES_H
+
+#include <stdint.h>
+#include <ftl/memory/flash.hpp>
+
+#define ball_frames_width 8
+#define ball_frames_height 8
+
+static const uint8_t ball_frames[] FTL_FLASH = {
+    0x02, 0x05, 0x00, 0x0f, 0x00, 0x08, 0x08, 0x81, 0x3c, 0x7e, 0x43, 0xff,
+    0x81, 0x7e, 0x3c, 0x08, 0x08, 0x81, 0x3c, 0x42, 0x43, 0x81, 0x81, 0x42,
+    0x3c,
+};
+
+#endif
@@ -0,0 +1,81 @@
+//
+// Bouncing animated sprites over a background on SSD1306
+//
+// Only the areas the sprites move through are redrawn and sent to the panel.
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+
+#include <stdint.h>
+
+#include <ftl/drivers/displays/ssd1306_transport.hpp>
+#include <ftl/gfx/adaptors/ssd1306_display.hpp>
+#include <ftl/gfx/sprite_layer.hpp>
+#include <ftl/memory/memreader.hpp>
+#include <ftl/platform/platform.hpp>
+
+// Generated with scripts/xbm2sprite.py --flash
+#include "ball_frames.h"
+#include "dino_sprite.h"
+
+#define OLED_ADDRESS 0x3C
+
+using namespace ftl::drivers;
+using namespace ftl::gfx;
+using namespace ftl::platform;
+
+using Reader = ftl::memory::FlashReader;
+using Display = Ssd1306Display<Ssd1306I2C<Hardware::I2C0>, Reader>;
+
+static void bounce(AnimatedSprite<Reader>& s, const Display& display)
+{
+    const int max_x = static_cast<int>(display.width()) - ball_frames_width;
+    const int max_y = static_cast<int>(display.height()) - ball_frames_height;
+
+    const int vx = (s.x() <= 0 && s.vx() < 0) || (s.x() >= max_x && s.vx() > 0) ? -s.vx() : s.vx();
+    const int vy = (s.y() <= 0 && s.vy() < 0) || (s.y() >= max_y && s.vy() > 0) ? -s.vy() : s.vy();
+
+    s.setVelocity(vx, vy);
+}
+
+int main()
+{
+    Hardware::I2C0::initialize(ftl::comms::i2c::ClockMode::Fast);
+
+    Display display{OLED_ADDRESS};
+    display.initialize();
+
+    SpriteLayer<Reader> layer{dino_sprite};
+
+    // Velocities in 1/16 pixels per step
+    AnimatedSprite<Reader> balls[] = {
+        {ball_frames, 0, 0, 4},
+        {ball_frames, 60, 40, 6},
+        {ball_frames, 100, 10, 3},
+    };
+    balls[0].setVelocity(24, 12);
+    balls[1].setVelocity(-18, 20);
+    balls[2].setVelocity(10, -28);
+
+    for (auto& ball : balls)
+    {
+        layer.add(ball);
+    }
+
+    layer.redraw(display);
+    display.update();
+
+    for(;;)
+    {
+        for (auto& ball : balls)
+        {
+            bounce(ball, display);
+        }
+
+        layer.step();
+        layer.render(display);
+    }
+
+    return 0;
+}
@@ -0,0 +1,73 @@
+//
+// Retained mode widgets on SSD1306
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+
+#include <stdint.h>
+
+#include <ftl/comms/i2c/i2c_device.hpp>
+
+#include <ftl/drivers/displays/ssd1306_transport.hpp>
+#include <ftl/gfx/adaptors/ssd1306_display.hpp>
+#include <ftl/gfx/adaptors/virtual_display.hpp>
+#include <ftl/gfx/widget.hpp>
+#include <ftl/gfx/fonts/basic_font.hpp>
+#include <ftl/memory/flash.hpp>
+#include <ftl/platform/platform.hpp>
+
+#define OLED_ADDRESS 0x3C
+
+using namespace ftl::drivers;
+using namespace ftl::gfx;
+using namespace ftl::platform;
+
+// 8x8 heart, a single literal run per page row
+static const uint8_t heart_sprite[] FTL_FLASH = {
+    8, 8,
+    0x87, 0x0C, 0x1E, 0x3E, 0x7C, 0x7C, 0x3E, 0x1E, 0x0C,
+};
+
+// The page font and the sprite are in flash
+using Reader = ftl::memory::FlashReader;
+using Display = Ssd1306Display<Ssd1306I2C<Hardware::I2C0>, Reader>;
+
+int main()
+{
+    Hardware::I2C0::initialize(ftl::comms::i2c::ClockMode::Fast);
+
+    Display oled{OLED_ADDRESS};
+    oled.initialize();
+    oled.setFont(&fonts::BASIC_PAGE_FONT);
+
+    VirtualDisplay<Display> display{oled};
+
+    Label<Reader> title{Rect{0, 0, 127, 7}, "FTL WIDGETS"};
+    NumericField<6, Reader> counter{0, 16};
+    Bar<Reader> progress{Rect{0, 32, 127, 41}, 100};
+    Icon<Reader> heart{120, 0, heart_sprite};
+
+    Screen<Reader> screen;
+    screen.add(title);
+    screen.add(counter);
+    screen.add(progress);
+    screen.add(heart);
+
+    int count = 0;
+
+    for(;;)
+    {
+        // Each render sends only the cells and columns that changed
+        counter.setValue(count);
+        progress.setValue(count % 101);
+        heart.setVisible(count & 0x08);
+
+        screen.render(display);
+
+        count++;
+        Hardware::Timer::delayMs(50);
+    }
+
+    return 0;
+}
@@ -0,0 +1,99 @@
+//
+// counting_i2c.hpp
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+#ifndef FTL_COMMS_I2C_COUNTING_I2C_HPP
+#define FTL_COMMS_I2C_COUNTING_I2C_HPP
+
+#include <stdint.h>
+
+#include <ftl/comms/i2c.hpp>
+
+namespace ftl
+{
+namespace comms
+{
+namespace i2c
+{
+    /**
+     * I2C interface wrapper that counts the bytes put on the bus, for measuring the bus cost of a driver.
+     *
+     * Address bytes (SLA+RW) and data bytes are counted. Counts are shared by every instance wrapping the same
+     * interface, like the bus itself.
+     *
+     * \tparam I2C Wrapped I2C interface (e.g. `Hardware::I2C0`)
+    */
+    template<class I2C>
+    class CountingI2C
+    {
+    public:
+        static void initialize(ClockMode clock = ClockMode::Normal)
+        {
+            I2C::initialize(clock);
+        }
+
+        void begin(uint8_t address, SlaMode mode)
+        {
+            bytes_++;
+            transactions_++;
+            i2c_.begin(address, mode);
+        }
+
+        void stop()
+        {
+            i2c_.stop();
+        }
+
+        void write(uint8_t data)
+        {
+            bytes_++;
+            i2c_.write(data);
+        }
+
+        uint8_t read(bool ack)
+        {
+            bytes_++;
+            return i2c_.read(ack);
+        }
+
+        /**
+         * @return bytes put on the bus since the last reset
+        */
+        static unsigned long bytes()
+        {
+            return bytes_;
+        }
+
+        /**
+         * @return transactions (START conditions) since the last reset
+        */
+        static unsigned long transactions()
+        {
+            return transactions_;
+        }
+
+        static void reset()
+        {
+            bytes_ = 0;
+            transactions_ = 0;
+        }
+
+    private:
+        static unsigned long bytes_;
+        static unsigned long transactions_;
+
+        I2C i2c_;
+    };
+
+    template<class I2C>
+    unsigned long CountingI2C<I2C>::bytes_ = 0;
+
+    template<class I2C>
+    unsigned long CountingI2C<I2C>::transactions_ = 0;
+}
+}
+}
+
+#endif // FTL_COMMS_I2C_COUNTING_I2C_HPP
@@ -0,0 +1,58 @@
+//
+// comms/spi.hpp
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+
+#ifndef FTL_COMMS_SPI_HPP
+#define FTL_COMMS_SPI_HPP
+
+#include <stdint.h>
+
+namespace ftl
+{
+namespace comms
+{
+namespace spi
+{
+    /**
+     * SCK frequency as a division of the CPU clock
+    */
+    enum class ClockDivider : uint8_t
+    {
+        Div2,
+        Div4,
+        Div8,
+        Div16,
+        Div32,
+        Div64,
+        Div128,
+    };
+
+    /**
+     * Clock polarity and phase
+     *
+     * Mode0 - CPOL=0 CPHA=0
+     * Mode1 - CPOL=0 CPHA=1
+     * Mode2 - CPOL=1 CPHA=0
+     * Mode3 - CPOL=1 CPHA=1
+    */
+    enum class Mode : uint8_t
+    {
+        Mode0 = 0,
+        Mode1 = 1,
+        Mode2 = 2,
+        Mode3 = 3,
+    };
+
+    enum class BitOrder : uint8_t
+    {
+        MsbFirst,
+        LsbFirst,
+    };
+}
+}
+}
+
+#endif // FTL_COMMS_SPI_HPP
@@ -0,0 +1,141 @@
+//
+// loopback.hpp
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+#ifndef FTL_COMMS_SPI_LOOPBACK_HPP
+#define FTL_COMMS_SPI_LOOPBACK_HPP
+
+#include <stdint.h>
+
+#include <ftl/comms/spi.hpp>
+#include <ftl/gpio/gpio.hpp>
+
+namespace ftl
+{
+namespace comms
+{
+namespace spi
+{
+    /**
+     * Host stand-in for a hardware SPI interface, with MISO tied to MOSI.
+     *
+     * Every byte written is returned as the received byte and recorded, so SPI drivers can be exercised off target.
+     * The first N bytes since the last `clear()` are kept. `count()` keeps counting past N.
+     *
+     * \tparam N Number of bytes recorded
+    */
+    template<unsigned int N = 1024>
+    class LoopbackSPI
+    {
+    public:
+        static void initialize(ClockDivider = ClockDivider::Div2, Mode = Mode::Mode0, BitOrder = BitOrder::MsbFirst)
+        {
+            clear();
+        }
+
+        uint8_t transfer(uint8_t data)
+        {
+            if (count_ < N)
+            {
+                buffer_[count_] = data;
+            }
+            ++count_;
+
+            return data;
+        }
+
+        void write(const uint8_t* data, unsigned int len)
+        {
+            for (auto i = 0u; i < len; ++i)
+            {
+                transfer(data[i]);
+            }
+        }
+
+        void writeAsync(const uint8_t* data, unsigned int len)
+        {
+            write(data, len);
+        }
+
+        bool busy() const
+        {
+            return false;
+        }
+
+        void flush()
+        {
+        }
+
+        static void clear()
+        {
+            count_ = 0;
+        }
+
+        static const uint8_t* data()
+        {
+            return buffer_;
+        }
+
+        /**
+         * Number of bytes transferred since the last clear
+        */
+        static unsigned long count()
+        {
+            return count_;
+        }
+
+    private:
+        static uint8_t buffer_[N];
+        static unsigned long count_;
+    };
+
+    template<unsigned int N>
+    uint8_t LoopbackSPI<N>::buffer_[N];
+
+    template<unsigned int N>
+    unsigned long LoopbackSPI<N>::count_ = 0;
+
+    /**
+     * Host stand-in for a GPIO output pin. Each ID is a separate pin
+    */
+    template<unsigned int ID>
+    class LoopbackPin
+    {
+    public:
+        LoopbackPin(GpioState)
+        {
+        }
+
+        void set()
+        {
+            state_ = true;
+        }
+
+        void reset()
+        {
+            state_ = false;
+        }
+
+        void toggle()
+        {
+            state_ = !state_;
+        }
+
+        bool read()
+        {
+            return state_;
+        }
+
+    private:
+        static bool state_;
+    };
+
+    template<unsigned int ID>
+    bool LoopbackPin<ID>::state_ = false;
+}
+}
+}
+
+#endif // FTL_COMMS_SPI_LOOPBACK_HPP
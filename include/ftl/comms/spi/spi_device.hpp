@@ -0,0 +1,103 @@
+//
+// spi_device.hpp
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+#ifndef FTL_COMMS_SPI_SPI_DEVICE_HPP
+#define FTL_COMMS_SPI_SPI_DEVICE_HPP
+
+#include <stdint.h>
+
+#include <ftl/comms/spi.hpp>
+#include <ftl/gpio/gpio.hpp>
+
+namespace ftl
+{
+namespace comms
+{
+namespace spi
+{
+    /**
+     * SPI device selected by an active low chip select pin
+     *
+     * \tparam SPI Host SPI interface
+     * \tparam CS Chip select GPIO
+    */
+    template<class SPI, class CS>
+    class SpiDevice
+    {
+    public:
+        SpiDevice()
+            : cs_{GpioState::Output}
+        {
+            cs_.set();
+        }
+
+        /**
+         * Select the device. Waits for any pending transfer on the bus to complete first
+        */
+        void begin()
+        {
+            spi_.flush();
+            cs_.reset();
+        }
+
+        /**
+         * Wait for pending transfers to complete and deselect the device
+        */
+        void end()
+        {
+            spi_.flush();
+            cs_.set();
+        }
+
+        /**
+         * Exchange a single byte
+        */
+        uint8_t transfer(uint8_t data)
+        {
+            return spi_.transfer(data);
+        }
+
+        /**
+         * Write a single byte to the bus
+        */
+        void write(uint8_t data)
+        {
+            spi_.transfer(data);
+        }
+
+        /**
+         * Write a buffer to the bus, blocking until it is sent
+        */
+        void write(const uint8_t* data, unsigned int len)
+        {
+            spi_.write(data, len);
+        }
+
+        /**
+         * Start writing a buffer to the bus and return immediately.
+         *
+         * The buffer must stay valid until the transfer completes. `begin()`, `end()` and the blocking functions wait
+         * for it.
+        */
+        void writeAsync(const uint8_t* data, unsigned int len)
+        {
+            spi_.writeAsync(data, len);
+        }
+
+        SPI& getSpi()
+        {
+            return spi_;
+        }
+
+    private:
+        SPI spi_;
+        CS cs_;
+    };
+}
+}
+}
+
+#endif // FTL_COMMS_SPI_SPI_DEVICE_HPP
@@ -9,7 +9,8 @@
 
 #include <stdint.h>
 
-#include <ftl/comms/i2c/i2c_device.hpp>
+#include <ftl/drivers/displays/ssd1306_transport.hpp>
+#include <ftl/memory/flash.hpp>
 
 namespace ftl
 {
@@ -45,29 +46,23 @@ enum class Ssd1306_FrameInterval
 
 /**
  * SSD1306 - OLED display
- * 
- * I2C Bus Frame
- * 
- * |SLA+RW|Co:D/C#:000000|Data|Co:D/C#:0..0|...
- * 
- * Co   - continuation bit
- *      - If set to logic 0, transmission of the following information will contain data bytes only
- * D/C# - Data / Command selection bit
- *      - Determines if the next byte acts as a command or as data
- *      - Logic 0: The following byte is a command
- *      - Logic 1: The following byte is data for GDDRAM
- * 
+ *
  * GDDRAM is divided into 8 pages (PAGE0 - PAGE7).
  * COM0 - COM63 refers to pixel row.
  * SEG0 - SEG127 refers to pixel column
- * 
+ *
  * Both can be re-mapped to reverse the order.
+ *
+ * Every setter is a complete command transaction on its own. Setters called between `beginCommands()` and
+ * `endCommands()` are batched into a single transaction, which is how `initialize()`, `setWindow()` and the scroll
+ * setup functions send their command sequences.
+ *
+ * \tparam Transport Bus the panel is wired to (`Ssd1306I2C` or `Ssd1306Spi`)
+ * \tparam HEIGHT Panel height in pixels (e.g. 64 for 128x64 modules, 32 for 128x32 modules)
 */
-template<class I2C>
+template<class Transport, uint8_t HEIGHT = 64>
 class Ssd1306
 {
-    static constexpr uint8_t CONTROL_COMMAND = 0x00;
-    static constexpr uint8_t CONTROL_DATA = 0x40;
 
     // Constrast, followed by 8-bit constrast level
     static constexpr uint8_t COMMAND_CONTRAST = 0x81;
@@ -125,55 +120,34 @@ class Ssd1306
     // Charge Pump
     static constexpr uint8_t COMMAND_CHARGE_PUMP = 0x8D;
 
-    static constexpr uint8_t NUM_PAGES = 8;
     static constexpr uint8_t ROW_PER_PAGE = 8;
     static constexpr uint8_t COL_PER_PAGE = 128;
 
+    static_assert(HEIGHT >= 16 && HEIGHT <= 64 && (HEIGHT % ROW_PER_PAGE) == 0, "Invalid SSD1306 panel height");
+
 public:
     static constexpr uint8_t WIDTH = 128;
-    // static constexpr uint8_t HEIGHT = 64;
-
-    Ssd1306(uint8_t address, uint8_t height)
-        : device_{address}
-        , height_{height}
-    {
-    }
+    static constexpr uint8_t NUM_PAGES = HEIGHT / ROW_PER_PAGE;
 
-    Ssd1306(uint8_t address)
-        : Ssd1306{address, 64}
+    /**
+     * Arguments are forwarded to the transport (e.g. the I2C address)
+    */
+    template<typename... Args>
+    Ssd1306(Args... args)
+        : transport_(args...)
+        , batch_depth_{0}
     {
     }
 
     bool initialize()
     {
-        if (!device_.detect())
+        if (!transport_.detect())
         {
             // Failed to detect
             return false;
         }
 
-        enable(false);
-        setDisplayOffset(0);
-        setDisplayStartLine(0);
-        setSegmentRemap(true);
-        setComScanReverse(false);
-        if (height_ == 64)
-        {
-            setComConfig(true, false);
-        }
-        else
-        {
-            // height = 32
-            setComConfig(false, false);
-        }
-        setConstrast(0x7F);
-        setClockConfig(0x00, 0x08);
-        setMultiplexRatio(height_ - 1);
-        enableChargePump(true);
-        invert(false);
-        scroll(false);
-        enable(true);
-        resume();
+        sendCommands(INIT_SEQUENCE, sizeof(INIT_SEQUENCE), memory::FlashReader{});
 
         clear();
 
@@ -199,7 +173,7 @@ public:
 
     bool detect()
     {
-        return device_.detect();
+        return transport_.detect();
     }
 
     void enable(bool on)
@@ -219,8 +193,8 @@ public:
 
     void setConstrast(uint8_t value)
     {
-        sendCommand(COMMAND_CONTRAST);
-        sendCommand(value);
+        const uint8_t cmds[] = {COMMAND_CONTRAST, value};
+        sendCommands(cmds, sizeof(cmds));
     }
 
     /**
@@ -228,14 +202,17 @@ public:
     */
     void setColumnStartAddressPaging(uint8_t address)
     {
-        sendCommand(COMMAND_PAGE_MODE_SET_LOW_COL_START | static_cast<uint8_t>(address & 0x0F));
-        sendCommand(COMMAND_PAGE_MODE_SET_HIGH_COL_START | static_cast<uint8_t>(address >> 4));
+        const uint8_t cmds[] = {
+            static_cast<uint8_t>(COMMAND_PAGE_MODE_SET_LOW_COL_START | (address & 0x0F)),
+            static_cast<uint8_t>(COMMAND_PAGE_MODE_SET_HIGH_COL_START | (address >> 4)),
+        };
+        sendCommands(cmds, sizeof(cmds));
     }
 
     void setAddresingMode(Ssd1306_AddressingMode mode)
     {
-        sendCommand(COMMAND_ADDRESSING_MODE);
-        sendCommand(static_cast<uint8_t>(mode));
+        const uint8_t cmds[] = {COMMAND_ADDRESSING_MODE, static_cast<uint8_t>(mode)};
+        sendCommands(cmds, sizeof(cmds));
     }
 
     /**
@@ -246,16 +223,31 @@ public:
     */
     void setColumnAddress(uint8_t start, uint8_t end)
     {
-        sendCommand(COMMAND_COLUMN_ADDRESS);
-        sendCommand(start);
-        sendCommand(end);
+        const uint8_t cmds[] = {COMMAND_COLUMN_ADDRESS, start, end};
+        sendCommands(cmds, sizeof(cmds));
     }
 
     void setPageAddress(uint8_t start, uint8_t end)
     {
-        sendCommand(COMMAND_SET_PAGE_ADDRESS);
-        sendCommand(start & 0x07);
-        sendCommand(end & 0x07);
+        const uint8_t cmds[] = {
+            COMMAND_SET_PAGE_ADDRESS,
+            static_cast<uint8_t>(start & 0x07),
+            static_cast<uint8_t>(end & 0x07),
+        };
+        sendCommands(cmds, sizeof(cmds));
+    }
+
+    /**
+     * Set the column and page range written by GDDRAM data in horizontal or vertical addressing mode.
+     *
+     * Both ranges are sent in a single command transaction.
+    */
+    void setWindow(uint8_t col_start, uint8_t col_end, uint8_t page_start, uint8_t page_end)
+    {
+        beginCommands();
+        setColumnAddress(col_start, col_end);
+        setPageAddress(page_start, page_end);
+        endCommands();
     }
 
     void setPageStart(uint8_t address)
@@ -283,8 +275,8 @@ public:
 
     void setMultiplexRatio(uint8_t ratio)
     {
-        sendCommand(COMMAND_MULTIPLEX_RATIO);
-        sendCommand(ratio & 0x3F);
+        const uint8_t cmds[] = {COMMAND_MULTIPLEX_RATIO, static_cast<uint8_t>(ratio & 0x3F)};
+        sendCommands(cmds, sizeof(cmds));
     }
 
     /**
@@ -299,8 +291,8 @@ public:
 
     void setDisplayOffset(uint8_t offset)
     {
-        sendCommand(COMMAND_DISPLAY_OFFSET);
-        sendCommand(offset & 0x3F);
+        const uint8_t cmds[] = {COMMAND_DISPLAY_OFFSET, static_cast<uint8_t>(offset & 0x3F)};
+        sendCommands(cmds, sizeof(cmds));
     }
 
     /**
@@ -311,11 +303,11 @@ public:
     */
     void setComConfig(bool com_alt, bool left_right_remap)
     {
-        const auto config = (static_cast<uint8_t>(com_alt) << 4)
-                          | (static_cast<uint8_t>(left_right_remap) << 5)
-                          | 0x02;
-        sendCommand(COMMAND_COM_CONFIG);
-        sendCommand(config);
+        const uint8_t config = (static_cast<uint8_t>(com_alt) << 4)
+                             | (static_cast<uint8_t>(left_right_remap) << 5)
+                             | 0x02;
+        const uint8_t cmds[] = {COMMAND_COM_CONFIG, config};
+        sendCommands(cmds, sizeof(cmds));
     }
 
     /**
@@ -326,20 +318,23 @@ public:
     */
     void setClockConfig(uint8_t divide, uint8_t freq)
     {
-        sendCommand(COMMAND_DISPLAY_CLOCK_DIVIDE);
-        sendCommand(((freq & 0x0F) << 4) | (divide & 0x0F));
+        const uint8_t cmds[] = {
+            COMMAND_DISPLAY_CLOCK_DIVIDE,
+            static_cast<uint8_t>(((freq & 0x0F) << 4) | (divide & 0x0F)),
+        };
+        sendCommands(cmds, sizeof(cmds));
     }
 
     void setPrecharge(uint8_t data)
     {
-        sendCommand(COMMAND_PRE_CHARGE_PERIOD);
-        sendCommand(data);
+        const uint8_t cmds[] = {COMMAND_PRE_CHARGE_PERIOD, data};
+        sendCommands(cmds, sizeof(cmds));
     }
 
     void setDeselect(uint8_t data)
     {
-        sendCommand(COMMAND_DESELECT_LEVEL);
-        sendCommand(data);
+        const uint8_t cmds[] = {COMMAND_DESELECT_LEVEL, data};
+        sendCommands(cmds, sizeof(cmds));
     }
 
     /**
@@ -349,10 +344,10 @@ public:
     */
     void enableChargePump(bool enabled)
     {
-        sendCommand(COMMAND_CHARGE_PUMP);
         // 0x14 to enable
         // 0x10 to disable
-        sendCommand(0x10 | (static_cast<uint8_t>(enabled) << 2));
+        const uint8_t cmds[] = {COMMAND_CHARGE_PUMP, static_cast<uint8_t>(0x10 | (static_cast<uint8_t>(enabled) << 2))};
+        sendCommands(cmds, sizeof(cmds));
     }
 
     void nop()
@@ -373,19 +368,22 @@ public:
     */
     void setupVerticalAndHorizontalScroll(Ssd1306_ScrollDirection dir, uint8_t page_start, uint8_t page_end, Ssd1306_FrameInterval interval, uint8_t scroll_offset)
     {
-        uint8_t mode = (dir == Ssd1306_ScrollDirection::Right) ? 0x29 : 0x2A;
-        // Set the scroll mode
-        sendCommand(static_cast<uint8_t>(mode));
-        // Dummy byte
-        sendCommand(0x00);
-        // Set the start page address
-        sendCommand(page_start & 0x07);
-        // Set frame interval between scroll steps
-        sendCommand(static_cast<uint8_t>(interval));
-        // Set page end
-        sendCommand(page_end & 0x07);
-        // Set the vertical scroll offset
-        sendCommand(scroll_offset & 0x3F);
+        const uint8_t mode = (dir == Ssd1306_ScrollDirection::Right) ? 0x29 : 0x2A;
+        const uint8_t cmds[] = {
+            // Set the scroll mode
+            mode,
+            // Dummy byte
+            0x00,
+            // Set the start page address
+            static_cast<uint8_t>(page_start & 0x07),
+            // Set frame interval between scroll steps
+            static_cast<uint8_t>(interval),
+            // Set page end
+            static_cast<uint8_t>(page_end & 0x07),
+            // Set the vertical scroll offset
+            static_cast<uint8_t>(scroll_offset & 0x3F),
+        };
+        sendCommands(cmds, sizeof(cmds));
     }
 
     /**
@@ -393,19 +391,22 @@ public:
     */
     void setupHorizontalScroll(Ssd1306_ScrollDirection dir, uint8_t page_start, uint8_t page_end, Ssd1306_FrameInterval interval)
     {
-        // Send horizontal scroll with the direction bit
-        sendCommand(COMMAND_SCROLL_HORIZONTAL | static_cast<uint8_t>(dir));
-        // dummy byte
-        sendCommand(0x00);
-        // set the start page
-        sendCommand(page_start & 0x07);
-        // set the frame interval between scroll sets
-        sendCommand(static_cast<uint8_t>(interval));
-        // set the end page
-        sendCommand(page_end & 0x07);
-        // dummy bytes
-        sendCommand(0x00);
-        sendCommand(0xFF);
+        const uint8_t cmds[] = {
+            // Send horizontal scroll with the direction bit
+            static_cast<uint8_t>(COMMAND_SCROLL_HORIZONTAL | static_cast<uint8_t>(dir)),
+            // dummy byte
+            0x00,
+            // set the start page
+            static_cast<uint8_t>(page_start & 0x07),
+            // set the frame interval between scroll sets
+            static_cast<uint8_t>(interval),
+            // set the end page
+            static_cast<uint8_t>(page_end & 0x07),
+            // dummy bytes
+            0x00,
+            0xFF,
+        };
+        sendCommands(cmds, sizeof(cmds));
     }
 
     /**
@@ -413,25 +414,46 @@ public:
     */
     void setVerticalScrollArea(uint8_t top_fixed_rows, uint8_t scroll_area_rows)
     {
-        sendCommand(COMMAND_SET_VERTICAL_SCROLL_AREA);
-        sendCommand(top_fixed_rows & 0x3F);
-        sendCommand(scroll_area_rows & 0x7F);
+        const uint8_t cmds[] = {
+            COMMAND_SET_VERTICAL_SCROLL_AREA,
+            static_cast<uint8_t>(top_fixed_rows & 0x3F),
+            static_cast<uint8_t>(scroll_area_rows & 0x7F),
+        };
+        sendCommands(cmds, sizeof(cmds));
     }
 
     /**
      * Send a data buffer GDDRAM
     */
-    void sendBuffer(const uint8_t* buffer, unsigned long length)
+    void sendBuffer(const uint8_t* buffer, unsigned int length)
     {
-        if (device_.begin(comms::i2c::SlaMode::Write))
-        {
-            device_.write(CONTROL_DATA);
-            for (auto i = 0u; i < length; ++i)
-            {
-                device_.write(buffer[i]);
-            }
-            device_.end();
-        }
+        beginData();
+        writeData(buffer, length);
+        endData();
+    }
+
+    /**
+     * Start a GDDRAM data transaction. Data written until `endData()` shares a single transaction and control byte
+    */
+    void beginData()
+    {
+        transport_.beginData();
+    }
+
+    /**
+     * Write GDDRAM data in the transaction opened by `beginData()`
+    */
+    void writeData(const uint8_t* buffer, unsigned int length)
+    {
+        transport_.write(buffer, length);
+    }
+
+    /**
+     * End a GDDRAM data transaction
+    */
+    void endData()
+    {
+        transport_.end();
     }
 
     void sendByte(uint8_t data)
@@ -439,20 +461,91 @@ public:
         sendBuffer(&data, 1);
     }
 
+    /**
+     * Start a command batch.
+     *
+     * Commands sent until the matching `endCommands()` share a single transaction and control byte. Batches nest, only
+     * the outermost pair starts and ends the transaction. GDDRAM data must not be sent while a batch is open.
+    */
+    void beginCommands()
+    {
+        if (batch_depth_++ == 0)
+        {
+            transport_.beginCommands();
+        }
+    }
+
+    /**
+     * End a command batch
+    */
+    void endCommands()
+    {
+        if (batch_depth_ > 0 && --batch_depth_ == 0)
+        {
+            transport_.end();
+        }
+    }
+
+    /**
+     * Send a sequence of command bytes in a single transaction
+    */
+    void sendCommands(const uint8_t* cmds, uint8_t length)
+    {
+        sendCommands(cmds, length, memory::DefaultMemoryReader{});
+    }
+
+    /**
+     * Send a sequence of command bytes, read using `reader`, in a single transaction
+    */
+    template<class Reader>
+    void sendCommands(const uint8_t* cmds, uint8_t length, const Reader& reader)
+    {
+        beginCommands();
+        for (auto i = 0u; i < length; ++i)
+        {
+            transport_.write(reader(cmds, i));
+        }
+        endCommands();
+    }
+
 private:
     /**
      * Send a command to the display
     */
     void sendCommand(uint8_t cmd)
     {
-        device_.begin(comms::i2c::SlaMode::Write);
-        device_.write(CONTROL_COMMAND);
-        device_.write(cmd);
-        device_.end();
+        sendCommands(&cmd, 1);
     }
 
-    ftl::comms::i2c::I2CDevice<I2C> device_;
-    uint8_t height_;
+    // Power on command sequence, sent as a single batch from flash
+    static const uint8_t INIT_SEQUENCE[];
+
+    Transport transport_;
+    uint8_t batch_depth_;
+};
+
+template<class Transport, uint8_t HEIGHT>
+const uint8_t Ssd1306<Transport, HEIGHT>::INIT_SEQUENCE[] FTL_FLASH = {
+    // Display off
+    COMMAND_DISPLAY_ON | 0x00,
+    COMMAND_DISPLAY_OFFSET, 0x00,
+    COMMAND_DISPLAY_START_LINE | 0x00,
+    // Column address 127 is mapped to SEG0
+    COMMAND_SEGMENT_REMAP | 0x01,
+    COMMAND_COM_SCAN_DIRECTION,
+    // 128x64 panels use the alternative COM pin configuration, shorter panels use sequential
+    COMMAND_COM_CONFIG, (HEIGHT > 32) ? 0x12 : 0x02,
+    COMMAND_CONTRAST, 0x7F,
+    COMMAND_DISPLAY_CLOCK_DIVIDE, 0x80,
+    COMMAND_MULTIPLEX_RATIO, HEIGHT - 1,
+    // Enable the charge pump
+    COMMAND_CHARGE_PUMP, 0x14,
+    COMMAND_DISPLAY_INVERSE | 0x00,
+    // Scroll off
+    COMMAND_SCROLL_ACTIVATION | 0x00,
+    // Display on
+    COMMAND_DISPLAY_ON | 0x01,
+    COMMAND_DISPLAY_RESUME | 0x00,
 };
 
 }
@@ -0,0 +1,151 @@
+//
+// ssd1306_transport.hpp
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+#ifndef FTL_DRIVERS_DISPLAYS_SSD1306_TRANSPORT_HPP
+#define FTL_DRIVERS_DISPLAYS_SSD1306_TRANSPORT_HPP
+
+#include <stdint.h>
+
+#include <ftl/comms/i2c/i2c_device.hpp>
+#include <ftl/comms/spi/spi_device.hpp>
+#include <ftl/gpio/gpio.hpp>
+
+namespace ftl
+{
+namespace drivers
+{
+
+/**
+ * SSD1306 I2C transport
+ *
+ * |SLA+RW|Co:D/C#:000000|Data|Co:D/C#:0..0|...
+ *
+ * Co   - continuation bit
+ *      - If set to logic 0, transmission of the following information will contain data bytes only
+ * D/C# - Data / Command selection bit
+ *      - Determines if the next byte acts as a command or as data
+ *      - Logic 0: The following byte is a command
+ *      - Logic 1: The following byte is data for GDDRAM
+ *
+ * \tparam I2C Host I2C interface
+*/
+template<class I2C>
+class Ssd1306I2C
+{
+    static constexpr uint8_t CONTROL_COMMAND = 0x00;
+    static constexpr uint8_t CONTROL_DATA = 0x40;
+
+public:
+    Ssd1306I2C(uint8_t address)
+        : device_{address}
+    {
+    }
+
+    bool detect()
+    {
+        return device_.detect();
+    }
+
+    /**
+     * Start a transaction of command bytes
+    */
+    void beginCommands()
+    {
+        device_.begin(comms::i2c::SlaMode::Write);
+        device_.write(CONTROL_COMMAND);
+    }
+
+    /**
+     * Start a transaction of GDDRAM data bytes
+    */
+    void beginData()
+    {
+        device_.begin(comms::i2c::SlaMode::Write);
+        device_.write(CONTROL_DATA);
+    }
+
+    void write(uint8_t data)
+    {
+        device_.write(data);
+    }
+
+    void write(const uint8_t* data, unsigned int len)
+    {
+        for (auto i = 0u; i < len; ++i)
+        {
+            device_.write(data[i]);
+        }
+    }
+
+    void end()
+    {
+        device_.end();
+    }
+
+private:
+    comms::i2c::I2CDevice<I2C> device_;
+};
+
+/**
+ * SSD1306 4-wire SPI transport
+ *
+ * The D/C# pin selects whether bytes are commands (low) or GDDRAM data (high). The panel is write only over SPI, so
+ * `detect()` always succeeds. Driving the RES# pin is left to the application.
+ *
+ * \tparam SPI Host SPI interface (mode 0, MSB first)
+ * \tparam CS Chip select GPIO
+ * \tparam DC Data / Command select GPIO
+*/
+template<class SPI, class CS, class DC>
+class Ssd1306Spi
+{
+public:
+    Ssd1306Spi()
+        : dc_{GpioState::Output}
+    {
+    }
+
+    bool detect()
+    {
+        return true;
+    }
+
+    void beginCommands()
+    {
+        device_.begin();
+        dc_.reset();
+    }
+
+    void beginData()
+    {
+        device_.begin();
+        dc_.set();
+    }
+
+    void write(uint8_t data)
+    {
+        device_.write(data);
+    }
+
+    void write(const uint8_t* data, unsigned int len)
+    {
+        device_.write(data, len);
+    }
+
+    void end()
+    {
+        device_.end();
+    }
+
+private:
+    comms::spi::SpiDevice<SPI, CS> device_;
+    DC dc_;
+};
+
+}
+}
+
+#endif // FTL_DRIVERS_DISPLAYS_SSD1306_TRANSPORT_HPP
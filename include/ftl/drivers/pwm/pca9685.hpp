@@ -15,6 +15,9 @@ namespace ftl
 {
 namespace drivers
 {
+template<typename I2C, uint8_t N>
+class Pca9685Array;
+
 /**
  * 16 channel PWM controller over I2C
  * 
@@ -30,13 +33,21 @@ class Pca9685
     static constexpr uint8_t MODE1_REGISTER = 0x00;
     static constexpr uint8_t MODE1_REGISTER_SLEEP_BIT = 4;
     static constexpr uint8_t MODE1_REGISTER_AI_BIT = 5;
+    static constexpr uint8_t MODE1_REGISTER_SUB1_BIT = 3;
+    static constexpr uint8_t MODE1_REGISTER_ALLCALL_BIT = 0;
 
     static constexpr uint8_t MODE2_REGISTER = 0x01;
     static constexpr uint8_t MODE2_REGISTER_INVERT_BIT = 4;
     static constexpr uint8_t MODE2_REGISTER_OUTPUT_CHANGE_BIT = 3;
     static constexpr uint8_t MODE2_REGISTER_OUTPUT_DRIVE_BIT = 2;
 
+    static constexpr uint8_t SUBADR1_REGISTER = 0x02;
+    static constexpr uint8_t ALLCALLADR_REGISTER = 0x05;
+
     static constexpr uint8_t LED_REGISTER_BASE = 0x06;
+    static constexpr uint8_t LED_REGISTER_SIZE = 4;
+
+    static constexpr uint8_t ALL_LED_REGISTER = 0xFA;
 
     static constexpr uint8_t PRESCALE_REGISTER = 0xFE;
 
@@ -44,10 +55,19 @@ class Pca9685
     static constexpr float BUILTIN_OSC_CLOCK_FREQ_HZ = 25000000.0f;
 
 public:
+    static constexpr uint8_t NUM_CHANNELS = 16;
+
     Pca9685(uint8_t addr, float ext_osc_freq)
         : device_{addr}
         , osc_freq_{ext_osc_freq}
+        , leds_{}
+        , dirty_{0}
     {
+        // Power on state of the LED registers, every channel fully off
+        for (auto channel = 0u; channel < NUM_CHANNELS; ++channel)
+        {
+            leds_[channel * LED_REGISTER_SIZE + 3] = 0x10;
+        }
     }
 
     Pca9685(uint8_t addr) : Pca9685{addr, BUILTIN_OSC_CLOCK_FREQ_HZ}
@@ -66,6 +86,11 @@ public:
         // enable(true);
         enableAutoIncrement(true);
 
+        // Start the shadow registers from what the device holds, the device may not have been reset with the host
+        comms::i2c::Register<I2C, sizeof(leds_)> leds{device_, LED_REGISTER_BASE};
+        leds.read(leds_);
+        dirty_ = 0;
+
         return true;
     }
 
@@ -107,6 +132,47 @@ public:
         return mode1.readBit(MODE1_REGISTER_AI_BIT);
     }
 
+    /**
+     * Respond to the LED All Call address
+     */
+    void enableAllCall(bool e)
+    {
+        comms::i2c::Uint8Register<I2C> mode1{device_, MODE1_REGISTER};
+        mode1.writeBit(e, MODE1_REGISTER_ALLCALL_BIT);
+    }
+
+    /**
+     * Set the LED All Call address (0x70 at power on), shared by every device that should receive broadcasts
+     */
+    void setAllCallAddress(uint8_t addr)
+    {
+        comms::i2c::Uint8Register<I2C> allcall{device_, ALLCALLADR_REGISTER};
+        allcall.write(addr << 1);
+    }
+
+    /**
+     * Respond to sub-address 1, 2 or 3
+     */
+    void enableSubAddress(uint8_t index, bool e)
+    {
+        if (index < 1 || index > 3) return;
+
+        comms::i2c::Uint8Register<I2C> mode1{device_, MODE1_REGISTER};
+        // SUB1 to SUB3 are in descending bit order
+        mode1.writeBit(e, MODE1_REGISTER_SUB1_BIT - (index - 1));
+    }
+
+    /**
+     * Set sub-address 1, 2 or 3, for addressing a group of devices at once
+     */
+    void setSubAddress(uint8_t index, uint8_t addr)
+    {
+        if (index < 1 || index > 3) return;
+
+        comms::i2c::Uint8Register<I2C> subaddr{device_, static_cast<uint8_t>(SUBADR1_REGISTER + (index - 1))};
+        subaddr.write(addr << 1);
+    }
+
     /**
      * Invert output
      */
@@ -212,19 +278,70 @@ public:
      */
     void setPWM(uint8_t channel, uint16_t on, uint16_t off)
     {
-        const auto base = LED_REGISTER_BASE + (4 * channel);
+        if (channel >= NUM_CHANNELS) return;
+
+        store(channel, on, off);
+        writeChannels(channel, channel);
 
+        // Anything staged for the channel has been replaced
+        dirty_ &= ~(1u << channel);
+    }
+
+    /**
+     * Set the ON and OFF values of every channel through the ALL_LED registers
+     *
+     * Sent to a driver on the All Call address or a sub-address, this sets every channel of every device in the
+     * group with one transaction.
+     */
+    void setAll(uint16_t on, uint16_t off)
+    {
         if (device_.begin(comms::i2c::SlaMode::Write))
         {
-            // Set the register pointer
-            device_.write(base);
-            // This driver leverages auto-increment to write to the pwm registers
+            device_.write(ALL_LED_REGISTER);
             device_.write(on & 0xFF);
             device_.write(on >> 8);
             device_.write(off & 0xFF);
             device_.write(off >> 8);
             device_.end();
         }
+
+        storeAll(on, off);
+    }
+
+    /**
+     * Stage ON and OFF values for a channel without sending them
+     *
+     * Staged values are sent by `commit()`. Staging the values a channel already has does nothing.
+     */
+    void stage(uint8_t channel, uint16_t on, uint16_t off)
+    {
+        if (channel >= NUM_CHANNELS) return;
+
+        if (store(channel, on, off))
+        {
+            dirty_ |= (1u << channel);
+        }
+    }
+
+    /**
+     * Send every staged channel
+     *
+     * Channels are written in one auto-increment transaction covering the lowest to the highest staged channel, so
+     * updating 16 servos costs one START/STOP and 66 bytes instead of 16 transactions of 6 bytes. Unchanged channels
+     * inside the range are rewritten with their current values. With the default output change on STOP, every channel
+     * in the commit switches at the same time.
+     */
+    void commit()
+    {
+        flush(true);
+    }
+
+    /**
+     * @return true if there are staged channels that have not been committed
+     */
+    bool pending() const
+    {
+        return dirty_ != 0;
     }
 
     /**
@@ -296,9 +413,95 @@ public:
     }
 
 private:
+    template<typename, uint8_t> friend class Pca9685Array;
+
+    /**
+     * Write the staged channels, optionally leaving the bus held so more devices can be written before the STOP
+     *
+     * @return true if anything was written
+     */
+    bool flush(bool stop)
+    {
+        if (!dirty_) return false;
+
+        uint8_t first = 0;
+        while (!(dirty_ & (1u << first))) ++first;
+
+        uint8_t last = NUM_CHANNELS - 1;
+        while (!(dirty_ & (1u << last))) --last;
+
+        writeChannels(first, last, stop);
+        dirty_ = 0;
+
+        return true;
+    }
+
+    /**
+     * Update the shadow registers of every channel after a write to the ALL_LED registers
+     */
+    void storeAll(uint16_t on, uint16_t off)
+    {
+        for (auto channel = 0u; channel < NUM_CHANNELS; ++channel)
+        {
+            store(channel, on, off);
+        }
+
+        dirty_ = 0;
+    }
+
+    /**
+     * Update the shadow registers of a channel
+     *
+     * @return true if the values changed
+     */
+    bool store(uint8_t channel, uint16_t on, uint16_t off)
+    {
+        uint8_t* led = leds_ + (channel * LED_REGISTER_SIZE);
+        const uint8_t values[] = {
+            static_cast<uint8_t>(on & 0xFF),
+            static_cast<uint8_t>(on >> 8),
+            static_cast<uint8_t>(off & 0xFF),
+            static_cast<uint8_t>(off >> 8),
+        };
+
+        bool changed = false;
+
+        for (auto i = 0u; i < LED_REGISTER_SIZE; ++i)
+        {
+            changed = changed || led[i] != values[i];
+            led[i] = values[i];
+        }
+
+        return changed;
+    }
+
+    /**
+     * Write the shadow registers of channels [first, last] in one transaction
+     */
+    void writeChannels(uint8_t first, uint8_t last, bool stop = true)
+    {
+        if (device_.begin(comms::i2c::SlaMode::Write))
+        {
+            // Set the register pointer
+            device_.write(LED_REGISTER_BASE + (LED_REGISTER_SIZE * first));
+            // This driver leverages auto-increment to write to the pwm registers
+            device_.write(leds_ + (LED_REGISTER_SIZE * first), LED_REGISTER_SIZE * (last - first + 1));
+
+            if (stop)
+            {
+                device_.end();
+            }
+        }
+    }
+
     comms::i2c::I2CDevice<I2C> device_;
     // Oscillator frequency
     float osc_freq_;
+
+    // Shadow of the LED ON/OFF registers, in register order
+    uint8_t leds_[NUM_CHANNELS * LED_REGISTER_SIZE];
+    // Channels staged but not yet committed
+    uint16_t dirty_;
 };
 }
 }
@@ -0,0 +1,243 @@
+//
+// pca9685_array.hpp
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+
+#ifndef FTL_DRIVERS_PWM_PCA9685_ARRAY_HPP
+#define FTL_DRIVERS_PWM_PCA9685_ARRAY_HPP
+
+#include <stdint.h>
+
+#include <ftl/drivers/pwm/pca9685.hpp>
+
+namespace ftl
+{
+namespace drivers
+{
+/**
+ * Several PCA9685 devices on one bus, addressed as a single bank of `N * 16` channels
+ *
+ * Channel `c` is channel `c % 16` of device `c / 16`, in the order the addresses are given:
+ *
+ *   Pca9685Array<Hardware::I2C0, 2> pwm{0x40, 0x41};
+ *   pwm.initialize();
+ *
+ *   for (auto c = 0u; c < pwm.size(); ++c)
+ *   {
+ *       pwm.stage(c, 0, 2048);
+ *   }
+ *   pwm.commit();
+ *
+ * Values shared by every channel are broadcast once on the LED All Call address with `setAll()`, instead of once per
+ * device. No device may use the All Call address (0x70 by default) as its own address.
+ *
+ * `commit()` writes the staged channels of every device back to back with repeated STARTs and a single STOP. Devices
+ * latch new outputs on STOP, so all of them change at the same moment.
+ *
+ * \tparam I2C Host device I2C (2-wire) interface
+ * \tparam N Number of devices
+ */
+template<typename I2C, uint8_t N>
+class Pca9685Array
+{
+    static_assert(N > 0, "A PCA9685 array needs at least one device");
+
+public:
+    using Driver = Pca9685<I2C>;
+
+    static constexpr uint8_t DEFAULT_ALLCALL_ADDRESS = 0x70;
+    static constexpr uint16_t NUM_CHANNELS = N * Driver::NUM_CHANNELS;
+
+    template<typename... Addresses>
+    Pca9685Array(Addresses... addresses)
+        : devices_{{static_cast<uint8_t>(addresses)}...}
+        , all_{DEFAULT_ALLCALL_ADDRESS}
+    {
+        static_assert(sizeof...(Addresses) == N, "Address count does not match the array size");
+    }
+
+    /**
+     * Initialize every device and enable All Call
+     *
+     * @return true if all devices were detected
+     */
+    bool initialize()
+    {
+        bool ok = true;
+
+        for (auto& device : devices_)
+        {
+            if (!device.initialize())
+            {
+                ok = false;
+                continue;
+            }
+
+            // Synchronised latching relies on outputs changing on STOP
+            device.setOutputChangeStop();
+            device.enableAllCall(true);
+        }
+
+        return ok;
+    }
+
+    /**
+     * Move every device to another All Call address
+     */
+    void setAllCallAddress(uint8_t addr)
+    {
+        for (auto& device : devices_)
+        {
+            device.setAllCallAddress(addr);
+        }
+
+        all_ = comms::i2c::I2CDevice<I2C>{addr};
+    }
+
+    /**
+     * Enable or disable every device
+     */
+    void enable(bool e)
+    {
+        for (auto& device : devices_)
+        {
+            device.enable(e);
+        }
+    }
+
+    /**
+     * Set the PWM frequency of every device. See `Pca9685::setFrequency()`
+     */
+    void setFrequency(float freq)
+    {
+        for (auto& device : devices_)
+        {
+            device.setFrequency(freq);
+        }
+    }
+
+    /**
+     * Set the ON and OFF values of a channel immediately
+     */
+    void setPWM(uint16_t channel, uint16_t on, uint16_t off)
+    {
+        if (channel >= NUM_CHANNELS) return;
+        devices_[channel / Driver::NUM_CHANNELS].setPWM(channel % Driver::NUM_CHANNELS, on, off);
+    }
+
+    /**
+     * Set every channel of every device in one broadcast transaction
+     */
+    void setAll(uint16_t on, uint16_t off)
+    {
+        if (all_.begin(comms::i2c::SlaMode::Write))
+        {
+            all_.write(Driver::ALL_LED_REGISTER);
+            all_.write(on & 0xFF);
+            all_.write(on >> 8);
+            all_.write(off & 0xFF);
+            all_.write(off >> 8);
+            all_.end();
+        }
+
+        for (auto& device : devices_)
+        {
+            device.storeAll(on, off);
+        }
+    }
+
+    /**
+     * Stage ON and OFF values for a channel, sent by `commit()`
+     */
+    void stage(uint16_t channel, uint16_t on, uint16_t off)
+    {
+        if (channel >= NUM_CHANNELS) return;
+        devices_[channel / Driver::NUM_CHANNELS].stage(channel % Driver::NUM_CHANNELS, on, off);
+    }
+
+    /**
+     * Send the staged channels of every device, latching them together on one STOP
+     */
+    void commit()
+    {
+        Driver* last = nullptr;
+
+        for (auto& device : devices_)
+        {
+            if (device.flush(false))
+            {
+                last = &device;
+            }
+        }
+
+        if (last)
+        {
+            last->device_.end();
+        }
+    }
+
+    /**
+     * @return true if any device has staged channels that have not been committed
+     */
+    bool pending() const
+    {
+        for (const auto& device : devices_)
+        {
+            if (device.pending()) return true;
+        }
+
+        return false;
+    }
+
+    Driver& operator[](uint8_t i)
+    {
+        return devices_[i];
+    }
+
+    static constexpr uint16_t size()
+    {
+        return NUM_CHANNELS;
+    }
+
+    ///=================================================================================================================
+    /// HAL Interfaces
+    ///=================================================================================================================
+
+    ///-----------------------------------------------------------------------------------------------------------------
+    /// GPIO Group Interface
+    ///-----------------------------------------------------------------------------------------------------------------
+
+    void setPinState(uint16_t channel, bool state)
+    {
+        if (channel >= NUM_CHANNELS) return;
+        devices_[channel / Driver::NUM_CHANNELS].setPinState(channel % Driver::NUM_CHANNELS, state);
+    }
+
+    ///-----------------------------------------------------------------------------------------------------------------
+    /// PWM Group Interface
+    ///-----------------------------------------------------------------------------------------------------------------
+
+    void setFrequency(uint16_t channel, float freq)
+    {
+        if (channel >= NUM_CHANNELS) return;
+        // Cannot set frequency per channel
+        devices_[channel / Driver::NUM_CHANNELS].setFrequency(freq);
+    }
+
+    void setDutyCycle(uint16_t channel, float duty)
+    {
+        if (channel >= NUM_CHANNELS) return;
+        devices_[channel / Driver::NUM_CHANNELS].setDutyCycle(channel % Driver::NUM_CHANNELS, duty);
+    }
+
+private:
+    Driver devices_[N];
+    // All Call address, for broadcasts
+    comms::i2c::I2CDevice<I2C> all_;
+};
+}
+}
+
+#endif // FTL_DRIVERS_PWM_PCA9685_ARRAY_HPP
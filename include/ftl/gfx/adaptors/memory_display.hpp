@@ -0,0 +1,237 @@
+//
+// memory_display.hpp
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+
+#ifndef FTL_GFX_ADAPTORS_MEMORY_DISPLAY_HPP
+#define FTL_GFX_ADAPTORS_MEMORY_DISPLAY_HPP
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <ftl/gfx/page_display.hpp>
+#include <ftl/gfx/page_framebuffer.hpp>
+#include <ftl/memory/memreader.hpp>
+
+namespace ftl
+{
+namespace gfx
+{
+
+/**
+ * Display that only renders into memory, for running drawing code on a host without a panel attached.
+ *
+ * Uses the same page framebuffer and drawing paths as `Ssd1306Display`, so a frame rendered here is byte for byte the
+ * GDDRAM the panel would receive. Frames can be written as PBM (1 bit) or PPM images and compared against a golden
+ * PBM image with `compare()`:
+ *
+ *   MemoryDisplay<> display;
+ *   draw(display);
+ *   if (display.compare("golden/screen.pbm") != 0) display.savePpm("screen.ppm", 4);
+ *
+ * Wrap in `VirtualDisplay` where a `RasterDisplay` is required.
+ *
+ * \tparam GfxReader Method of reading graphics data
+ * \tparam WIDTH Width in pixels
+ * \tparam HEIGHT Height in pixels, a multiple of 8
+*/
+template<typename GfxReader = memory::DefaultMemoryReader, unsigned int WIDTH = 128, unsigned int HEIGHT = 64>
+class MemoryDisplay
+    : public PageRasterDisplay<MemoryDisplay<GfxReader, WIDTH, HEIGHT>, PageFrameBuffer<WIDTH, HEIGHT / 8>, GfxReader>
+{
+    using Base = PageRasterDisplay<MemoryDisplay<GfxReader, WIDTH, HEIGHT>, PageFrameBuffer<WIDTH, HEIGHT / 8>,
+                                   GfxReader>;
+
+public:
+    using FrameBuffer = PageFrameBuffer<WIDTH, HEIGHT / 8>;
+
+    MemoryDisplay()
+        : Base{WIDTH, HEIGHT}
+        , updates_{0}
+    {
+    }
+
+    /**
+     * Nothing to send. Counts frames
+    */
+    void update()
+    {
+        updates_++;
+    }
+
+    void clear()
+    {
+        this->framebuffer_.clear();
+    }
+
+    /**
+     * @return 1 if the pixel is lit
+    */
+    uint8_t getPixel(unsigned int col, unsigned int row) const
+    {
+        return this->framebuffer_.getPixel(col, row);
+    }
+
+    FrameBuffer& getFrameBuffer()
+    {
+        return this->framebuffer_;
+    }
+
+    const FrameBuffer& getFrameBuffer() const
+    {
+        return this->framebuffer_;
+    }
+
+    /**
+     * @return number of calls to `update()`
+    */
+    unsigned int updates() const
+    {
+        return updates_;
+    }
+
+    /**
+     * @return number of pixels that differ from another frame
+    */
+    unsigned int diff(const MemoryDisplay& other) const
+    {
+        unsigned int n = 0;
+
+        for (auto row = 0u; row < HEIGHT; ++row)
+        {
+            for (auto col = 0u; col < WIDTH; ++col)
+            {
+                n += getPixel(col, row) != other.getPixel(col, row);
+            }
+        }
+
+        return n;
+    }
+
+    /**
+     * Write the frame as a binary PBM image. Lit pixels are white
+    */
+    bool writePbm(FILE* file) const
+    {
+        fprintf(file, "P4\n%u %u\n", WIDTH, HEIGHT);
+
+        for (auto row = 0u; row < HEIGHT; ++row)
+        {
+            // PBM rows are MSB first and 1 is black
+            uint8_t byte = 0;
+            for (auto col = 0u; col < WIDTH; ++col)
+            {
+                byte = (byte << 1) | !getPixel(col, row);
+
+                if ((col & 7) == 7 || col == WIDTH - 1)
+                {
+                    byte <<= 7 - (col & 7);
+                    if (fputc(byte, file) == EOF) return false;
+                    byte = 0;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * Write the frame as a binary PPM image, each pixel drawn as a scale x scale block. Lit pixels are white
+    */
+    bool writePpm(FILE* file, unsigned int scale = 1) const
+    {
+        if (scale == 0) return false;
+
+        fprintf(file, "P6\n%u %u\n255\n", WIDTH * scale, HEIGHT * scale);
+
+        for (auto y = 0u; y < HEIGHT * scale; ++y)
+        {
+            for (auto x = 0u; x < WIDTH * scale; ++x)
+            {
+                const uint8_t value = getPixel(x / scale, y / scale) ? 0xFF : 0x00;
+                const uint8_t rgb[3] = {value, value, value};
+
+                if (fwrite(rgb, 1, sizeof(rgb), file) != sizeof(rgb)) return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool savePbm(const char* path) const
+    {
+        return save(path, [this](FILE* file) { return writePbm(file); });
+    }
+
+    bool savePpm(const char* path, unsigned int scale = 1) const
+    {
+        return save(path, [this, scale](FILE* file) { return writePpm(file, scale); });
+    }
+
+    /**
+     * Load a binary PBM image of the display size into the framebuffer
+    */
+    bool loadPbm(const char* path)
+    {
+        FILE* file = fopen(path, "rb");
+        if (!file) return false;
+
+        unsigned int w = 0;
+        unsigned int h = 0;
+        bool ok = fscanf(file, "P4 %u %u", &w, &h) == 2 && w == WIDTH && h == HEIGHT;
+
+        // Single whitespace character before the raster
+        ok = ok && fgetc(file) != EOF;
+
+        for (auto row = 0u; ok && row < HEIGHT; ++row)
+        {
+            int byte = 0;
+            for (auto col = 0u; ok && col < WIDTH; ++col)
+            {
+                if ((col & 7) == 0)
+                {
+                    byte = fgetc(file);
+                    ok = byte != EOF;
+                }
+
+                this->framebuffer_.setPixel(col, row, !((byte >> (7 - (col & 7))) & 0x01));
+            }
+        }
+
+        fclose(file);
+        return ok;
+    }
+
+    /**
+     * Compare the frame against a golden PBM image
+     *
+     * @return number of pixels that differ, or -1 if the image could not be read
+    */
+    long compare(const char* path) const
+    {
+        MemoryDisplay golden;
+        if (!golden.loadPbm(path)) return -1;
+
+        return diff(golden);
+    }
+
+private:
+    template<class WriteFn>
+    static bool save(const char* path, WriteFn write)
+    {
+        FILE* file = fopen(path, "wb");
+        if (!file) return false;
+
+        const bool ok = write(file);
+        return (fclose(file) == 0) && ok;
+    }
+
+    unsigned int updates_;
+};
+
+}
+}
+
+#endif // FTL_GFX_ADAPTORS_MEMORY_DISPLAY_HPP
@@ -13,6 +13,11 @@
 
 #include <ftl/gfx/display.hpp>
 #include <ftl/gfx/color.hpp>
+#include <ftl/gfx/page_display.hpp>
+#include <ftl/gfx/page_framebuffer.hpp>
+#include <ftl/gfx/rect.hpp>
+#include <ftl/gfx/transpose.hpp>
+#include <ftl/gfx/update_policy.hpp>
 #include <ftl/memory/memreader.hpp>
 #include <ftl/utils/bitutil.hpp>
 
@@ -24,28 +29,84 @@ namespace ftl
 namespace gfx
 {
 
+/**
+ * Clockwise rotation of the displayed image
+*/
+enum class Rotation : uint8_t
+{
+    Rotate0,
+    Rotate90,
+    Rotate180,
+    Rotate270,
+};
+
+/**
+ * @return true if the rotation turns a landscape panel into a portrait display
+*/
+constexpr bool isPortrait(Rotation r)
+{
+    return r == Rotation::Rotate90 || r == Rotation::Rotate270;
+}
+
 /**
  * SSD1306 Display Adaptor
+ *
+ * Renders into a page framebuffer that is sent to the panel on `update()`. The framebuffer size, the page range sent
+ * on update and the panel configuration are fixed at compile time by the panel dimensions.
+ *
+ * Rotation and mirroring are done by the controller's segment remap and COM scan direction, so they cost nothing to
+ * draw or send. A ROTATION of 90 or 270 degrees lays the framebuffer out in portrait (HEIGHT x WIDTH) so drawing stays
+ * on the page fast paths, and `update()` transposes it to the panel an 8x8 tile at a time. `setRotation()` switches
+ * between rotations of the same orientation (0 and 180, or 90 and 270).
+ *
+ * Drawing is statically dispatched. Wrap in `VirtualDisplay` where a `RasterDisplay` is required.
+ *
+ * \tparam T Panel transport (`drivers::Ssd1306I2C` or `drivers::Ssd1306Spi`)
+ * \tparam GfxReader Method of reading graphics data
+ * \tparam WIDTH Panel width in pixels
+ * \tparam HEIGHT Panel height in pixels
+ * \tparam UpdatePolicy How the framebuffer is sent on `update()` (`FullUpdate` or `DiffUpdate`)
+ * \tparam ROTATION Initial rotation. Fixes the display as landscape or portrait
 */
-template<typename T, typename GfxReader = memory::DefaultMemoryReader>
-class Ssd1306Display : public RasterDisplay<GfxReader>
+template<typename T, typename GfxReader = memory::DefaultMemoryReader, uint8_t WIDTH = 128, uint8_t HEIGHT = 64,
+         typename UpdatePolicy = FullUpdate, Rotation ROTATION = Rotation::Rotate0>
+class Ssd1306Display
+    : public PageRasterDisplay<Ssd1306Display<T, GfxReader, WIDTH, HEIGHT, UpdatePolicy, ROTATION>,
+                               PageFrameBuffer<isPortrait(ROTATION) ? HEIGHT : WIDTH,
+                                               (isPortrait(ROTATION) ? WIDTH : HEIGHT) / 8>, GfxReader>
 {
-public:
-    static constexpr uint8_t NUM_COLUMNS = 128;
-    static constexpr uint8_t NUM_PAGES = 8;
-    static constexpr uint8_t NUM_ROWS_PER_PAGE = 8;
+    static constexpr bool PORTRAIT = isPortrait(ROTATION);
+
+    // Framebuffer dimensions, as drawn
+    static constexpr uint8_t FB_WIDTH = PORTRAIT ? HEIGHT : WIDTH;
+    static constexpr uint8_t FB_HEIGHT = PORTRAIT ? WIDTH : HEIGHT;
 
-    Ssd1306Display(uint8_t i2c_address, uint8_t height)
-        : RasterDisplay<GfxReader>{NUM_COLUMNS, height}
-        , driver_{i2c_address, height}
+    using FrameBuffer = PageFrameBuffer<FB_WIDTH, FB_HEIGHT / 8>;
+    using Base = PageRasterDisplay<Ssd1306Display<T, GfxReader, WIDTH, HEIGHT, UpdatePolicy, ROTATION>, FrameBuffer,
+                                   GfxReader>;
+    using Updater = typename UpdatePolicy::template Updater<WIDTH, HEIGHT / 8>;
+
+    template<bool>
+    struct Orientation
     {
-    }
+    };
+
+public:
+    static constexpr uint8_t NUM_COLUMNS = WIDTH;
+    static constexpr uint8_t NUM_PAGES = HEIGHT / 8;
+    static constexpr uint8_t NUM_ROWS_PER_PAGE = 8;
 
     /**
-     * Create an instance of an SSD1306 display.
+     * Create an instance of an SSD1306 display. Arguments are forwarded to the transport
     */
-    Ssd1306Display(uint8_t i2c_address)
-        : Ssd1306Display{i2c_address, 64}
+    template<typename... Args>
+    Ssd1306Display(Args... args)
+        : Base{FB_WIDTH, FB_HEIGHT}
+        , driver_{args...}
+        , rotation_{ROTATION}
+        , mirror_{false}
+        , com_reverse_{true}
+        , orientation_pending_{false}
     {
     }
 
@@ -58,62 +119,167 @@ public:
             return false;
         }
 
-        driver_.setComScanReverse(com_reverse);
+        com_reverse_ = com_reverse;
+
+        driver_.beginCommands();
+        applyOrientation();
         driver_.setAddresingMode(drivers::Ssd1306_AddressingMode::Horizontal);
-        driver_.setPageAddress(0, 7);
+        driver_.endCommands();
+
+        updater_.invalidate();
 
         return true;
     }
 
-    void drawPixel(unsigned int col, unsigned int row, const Color& c) override
+    /**
+     * Update the display with the current framebuffer
+    */
+    void update()
     {
-        auto& page = framebuffer_[row / NUM_ROWS_PER_PAGE];
-        const auto page_row = row % 8;
+        if (orientation_pending_) applyOrientation();
 
-        // FORCE(page[col], 1 << page_row, c.monochrome() << page_row);
-        page[col] = (page[col] & ~(1 << page_row)) | (c.monochrome() << page_row);
+        send(Orientation<PORTRAIT>{});
     }
 
     /**
-     * Update the display with the current framebuffer
+     * Update only the pages and columns of the display covering `area`. After a rotation or mirroring change the whole
+     * display is updated instead
+    */
+    void updateRegion(const Rect& area)
+    {
+        if (orientation_pending_)
+        {
+            update();
+            return;
+        }
+
+        const auto r = area.intersect(Rect{0, 0, FB_WIDTH - 1, FB_HEIGHT - 1});
+        if (r.empty()) return;
+
+        send(Orientation<PORTRAIT>{}, r);
+    }
+
+    /**
+     * Rotate the displayed image. Only rotations with the same orientation as ROTATION are possible, since the
+     * framebuffer layout is fixed at compile time. Takes effect on the next `update()`, which sends the remap commands
+     * together with the whole frame
+     *
+     * @return false if the rotation needs the other orientation
+    */
+    bool setRotation(Rotation rotation)
+    {
+        if (isPortrait(rotation) != PORTRAIT) return false;
+
+        rotation_ = rotation;
+        orientation_pending_ = true;
+
+        return true;
+    }
+
+    Rotation getRotation() const
+    {
+        return rotation_;
+    }
+
+    /**
+     * Mirror the displayed image left to right. Takes effect on the next `update()`
     */
-    void update() override
+    void setMirror(bool mirror)
     {
-        // Set the column address bounds to the entire display
-        driver_.setColumnAddress(0, 127);
-        driver_.setPageAddress(0, 7);
-        driver_.sendBuffer(&framebuffer_[0][0], sizeof(framebuffer_));
+        mirror_ = mirror;
+        orientation_pending_ = true;
     }
 
     void clear()
     {
         // zero framebuffer
-        for (auto page = 0u; page < NUM_PAGES; ++page)
-        {
-            for (auto col = 0u; col < NUM_COLUMNS; ++col)
-            {
-                framebuffer_[page][col] = 0x00;
-            }
-        }
+        this->framebuffer_.clear();
     }
 
     /**
      * @return the underlying display driver
     */
-    drivers::Ssd1306<T>& getDriver()
+    drivers::Ssd1306<T, HEIGHT>& getDriver()
     {
         return driver_;
     }
+
+    /**
+     * @return the update policy state (e.g. `DiffUpdate` statistics)
+    */
+    Updater& getUpdater()
+    {
+        return updater_;
+    }
+
 private:
-    using PageBuffer = uint8_t[NUM_COLUMNS];
-    using FrameBuffer = PageBuffer[NUM_PAGES];
+    void send(Orientation<false>)
+    {
+        updater_.update(driver_, this->framebuffer_);
+    }
+
+    void send(Orientation<true>)
+    {
+        const TransposedPages<WIDTH, NUM_PAGES, FrameBuffer> pages{this->framebuffer_};
+        updater_.update(driver_, pages);
+    }
 
-    // TODO: Allocate on heap?
-    FrameBuffer framebuffer_;
+    void send(Orientation<false>, const Rect& area)
+    {
+        updater_.update(driver_, this->framebuffer_, area);
+    }
+
+    void send(Orientation<true>, const Rect& area)
+    {
+        // Framebuffer rows are panel columns
+        const TransposedPages<WIDTH, NUM_PAGES, FrameBuffer> pages{this->framebuffer_};
+        updater_.update(driver_, pages, Rect{area.y0, area.x0, area.y1, area.x1});
+    }
 
-    drivers::Ssd1306<T> driver_;
+    /**
+     * Set the segment remap and COM scan direction for the rotation and mirroring
+    */
+    void applyOrientation()
+    {
+        // Panel axes reversed relative to the upright image. A portrait framebuffer is sent transposed, which turns
+        // the image a quarter turn when one axis is reversed
+        bool flip_columns = rotation_ == Rotation::Rotate90 || rotation_ == Rotation::Rotate180;
+        bool flip_rows = rotation_ == Rotation::Rotate180 || rotation_ == Rotation::Rotate270;
+
+        // Framebuffer columns run along panel rows in portrait
+        if (mirror_)
+        {
+            if (PORTRAIT) flip_rows = !flip_rows;
+            else flip_columns = !flip_columns;
+        }
+
+        driver_.beginCommands();
+        driver_.setSegmentRemap(!flip_columns);
+        driver_.setComScanReverse(com_reverse_ != flip_rows);
+        driver_.endCommands();
+
+        // Segment remap only applies to data written after it
+        updater_.invalidate();
+        orientation_pending_ = false;
+    }
+
+    drivers::Ssd1306<T, HEIGHT> driver_;
+    Updater updater_;
+
+    Rotation rotation_;
+    bool mirror_;
+    bool com_reverse_;
+    // Rotation or mirroring changed since the last update
+    bool orientation_pending_;
 };
 
+/**
+ * 128x32 SSD1306 module
+*/
+template<typename T, typename GfxReader = memory::DefaultMemoryReader, typename UpdatePolicy = FullUpdate,
+         Rotation ROTATION = Rotation::Rotate0>
+using Ssd1306Display128x32 = Ssd1306Display<T, GfxReader, 128, 32, UpdatePolicy, ROTATION>;
+
 }
 }
 
@@ -0,0 +1,149 @@
+//
+// ssd1306_panel_group.hpp
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+
+#ifndef FTL_GFX_SSD1306_PANEL_GROUP_HPP
+#define FTL_GFX_SSD1306_PANEL_GROUP_HPP
+
+#include <stdint.h>
+
+#include <ftl/gfx/adaptors/ssd1306_stream_display.hpp>
+
+namespace ftl
+{
+namespace gfx
+{
+
+/**
+ * Updates several SSD1306 panels through one shared page buffer.
+ *
+ * Panels are `Ssd1306StreamPanel`s that render into the same page buffer, so RAM for pixels is one 128 byte page in
+ * total instead of a framebuffer per panel. Two 128x64 panels on one bus (e.g. at 0x3C and 0x3D) fit on an ATmega328p:
+ *
+ *   using Panel = Ssd1306StreamPanel<Ssd1306I2C<Hardware::I2C0>>;
+ *
+ *   Panel::PageBuffer page;
+ *   Panel left{page, 0x3C};
+ *   Panel right{page, 0x3D};
+ *   Ssd1306PanelGroup<Panel, 2> panels{left, right};
+ *
+ *   left.drawString("Left", 0, 0, Color::white());
+ *   right.drawString("Right", 0, 0, Color::white());
+ *   panels.update();
+ *
+ * Updates are interleaved a page at a time (page 0 of every panel, then page 1, ...), so every panel starts showing
+ * the new frame straight away instead of waiting for the panels before it to finish. `step()` sends a single page, for
+ * spreading a frame over the main loop.
+ *
+ * \tparam PanelT Panel type (`Ssd1306StreamPanel`)
+ * \tparam COUNT Number of panels
+*/
+template<class PanelT, uint8_t COUNT>
+class Ssd1306PanelGroup
+{
+    static_assert(COUNT > 0, "A panel group needs at least one panel");
+
+public:
+    using PageBuffer = typename PanelT::PageBuffer;
+
+    template<typename... Panels>
+    Ssd1306PanelGroup(Panels&... panels)
+        : panels_{&panels...}
+        , page_{0}
+        , panel_{0}
+    {
+        static_assert(sizeof...(Panels) == COUNT, "Panel count does not match the group size");
+    }
+
+    /**
+     * Initialize every panel
+     *
+     * @return true if all panels were detected
+    */
+    bool initialize(bool com_reverse = true)
+    {
+        bool ok = true;
+
+        for (auto i = 0u; i < COUNT; ++i)
+        {
+            ok = panels_[i]->initialize(com_reverse) && ok;
+        }
+
+        return ok;
+    }
+
+    /**
+     * Send the rest of the current frame to every panel
+    */
+    void update()
+    {
+        while (step())
+        {
+        }
+    }
+
+    /**
+     * Render and send the next page of the current frame
+     *
+     * @return false once the last page of the frame has been sent
+    */
+    bool step()
+    {
+        auto& panel = *panels_[panel_];
+
+        if (page_ == 0)
+        {
+            panel.beginUpdate();
+        }
+
+        panel.updatePage(page_);
+
+        if (++panel_ < COUNT)
+        {
+            return true;
+        }
+
+        panel_ = 0;
+
+        if (++page_ < PanelT::NUM_PAGES)
+        {
+            return true;
+        }
+
+        page_ = 0;
+
+        return false;
+    }
+
+    /**
+     * @return true if a frame is partially sent
+    */
+    bool busy() const
+    {
+        return page_ != 0 || panel_ != 0;
+    }
+
+    PanelT& operator[](uint8_t i)
+    {
+        return *panels_[i];
+    }
+
+    static constexpr uint8_t size()
+    {
+        return COUNT;
+    }
+
+private:
+    PanelT* panels_[COUNT];
+
+    uint8_t page_;
+    uint8_t panel_;
+};
+
+}
+}
+
+#endif // FTL_GFX_SSD1306_PANEL_GROUP_HPP
@@ -0,0 +1,386 @@
+//
+// ssd1306_stream_display.hpp
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+
+#ifndef FTL_GFX_SSD1306_STREAM_DISPLAY_HPP
+#define FTL_GFX_SSD1306_STREAM_DISPLAY_HPP
+
+#include <stdint.h>
+
+#include <ftl/gfx/display.hpp>
+#include <ftl/gfx/display_list.hpp>
+#include <ftl/gfx/color.hpp>
+#include <ftl/gfx/page_display.hpp>
+#include <ftl/gfx/page_framebuffer.hpp>
+#include <ftl/memory/memreader.hpp>
+
+#include <ftl/drivers/displays/ssd1306.hpp>
+
+namespace ftl
+{
+namespace gfx
+{
+
+/**
+ * Draw call recording and page replay shared by `Ssd1306StreamDisplay` and `Ssd1306StreamPanel`.
+ *
+ * Derived classes provide the page buffer pages are rendered into with `pageBuffer()`.
+ *
+ * \tparam Derived The concrete display type
+ * \tparam T Panel transport (`drivers::Ssd1306I2C` or `drivers::Ssd1306Spi`)
+ * \tparam GfxReader Method of reading graphics data
+ * \tparam WIDTH Panel width in pixels
+ * \tparam HEIGHT Panel height in pixels
+ * \tparam N Maximum number of draw calls per frame
+*/
+template<class Derived, typename T, typename GfxReader, uint8_t WIDTH, uint8_t HEIGHT, unsigned int N>
+class Ssd1306StreamBase : public StaticRasterDisplay<Derived, GfxReader>
+{
+    using Base = StaticRasterDisplay<Derived, GfxReader>;
+
+public:
+    static constexpr uint8_t NUM_COLUMNS = WIDTH;
+    static constexpr uint8_t NUM_PAGES = HEIGHT / 8;
+
+    using PageBuffer = PageFrameBuffer<WIDTH, 1>;
+
+    template<typename... Args>
+    Ssd1306StreamBase(Args... args)
+        : Base{WIDTH, HEIGHT}
+        , frame_font_{nullptr}
+        , driver_{args...}
+    {
+    }
+
+    bool initialize(bool com_reverse = true)
+    {
+        if (!driver_.initialize())
+        {
+            return false;
+        }
+
+        driver_.beginCommands();
+        driver_.setComScanReverse(com_reverse);
+        driver_.setAddresingMode(drivers::Ssd1306_AddressingMode::Horizontal);
+        driver_.endCommands();
+
+        return true;
+    }
+
+    void drawPixel(unsigned int col, unsigned int row, const Color& c)
+    {
+        list_.record(DisplayOp::Pixel, c, col, row);
+    }
+
+    void drawLine(int x0, int y0, int x1, int y1, const Color& c)
+    {
+        list_.record(DisplayOp::Line, c, x0, y0, x1, y1);
+    }
+
+    void drawHLine(int x0, int y0, int w, const Color& c)
+    {
+        list_.record(DisplayOp::HLine, c, x0, y0, w);
+    }
+
+    void drawVLine(int x0, int y0, int h, const Color& c)
+    {
+        list_.record(DisplayOp::VLine, c, x0, y0, h);
+    }
+
+    void drawRect(int x0, int y0, int w, int h, const Color& c)
+    {
+        list_.record(DisplayOp::Rect, c, x0, y0, w, h);
+    }
+
+    void drawFillRect(int x0, int y0, int w, int h, const Color& c)
+    {
+        list_.record(DisplayOp::FillRect, c, x0, y0, w, h);
+    }
+
+    void drawXBitmap(const uint8_t* const bitmap, int x, int y, int w, int h, const Color& c)
+    {
+        list_.record(DisplayOp::XBitmap, c, x, y, w, h, bitmap);
+    }
+
+    void drawSprite(const uint8_t* const sprite, int x, int y, const Color& c)
+    {
+        list_.record(DisplayOp::Sprite, c, x, y, 0, 0, sprite);
+    }
+
+    void drawChar(const char ch, int x, int y, const Color& c)
+    {
+        list_.record(DisplayOp::Char, c, x, y, ch);
+    }
+
+    void drawString(const char* str, int x, int y, const Color& c)
+    {
+        list_.record(DisplayOp::String, c, x, y, 0, 0, str);
+    }
+
+    void drawScaledXBitmap(const uint8_t* const bitmap, int x, int y, int w, int h, uint8_t factor, const Color& c)
+    {
+        list_.record(DisplayOp::ScaledXBitmap, c, x, y, w, h, bitmap, factor);
+    }
+
+    void drawScaledChar(const char ch, int x, int y, uint8_t factor, const Color& c)
+    {
+        list_.record(DisplayOp::ScaledChar, c, x, y, ch, 0, nullptr, factor);
+    }
+
+    void drawScaledString(const char* str, int x, int y, uint8_t factor, const Color& c)
+    {
+        list_.record(DisplayOp::ScaledString, c, x, y, 0, 0, str, factor);
+    }
+
+    void drawCircle(int xc, int yc, int r, const Color& c)
+    {
+        list_.record(DisplayOp::Circle, c, xc, yc, r);
+    }
+
+    void drawFillCircle(int xc, int yc, int r, const Color& c)
+    {
+        list_.record(DisplayOp::FillCircle, c, xc, yc, r);
+    }
+
+    void drawArc(int xc, int yc, int r, uint8_t quadrants, const Color& c)
+    {
+        list_.record(DisplayOp::Arc, c, xc, yc, r, 0, nullptr, quadrants);
+    }
+
+    void drawEllipse(int xc, int yc, int rx, int ry, const Color& c)
+    {
+        list_.record(DisplayOp::Ellipse, c, xc, yc, rx, ry);
+    }
+
+    void drawFillEllipse(int xc, int yc, int rx, int ry, const Color& c)
+    {
+        list_.record(DisplayOp::FillEllipse, c, xc, yc, rx, ry);
+    }
+
+    /**
+     * Rounded rectangles are recorded with radii of at most 255
+    */
+    void drawRoundRect(int x0, int y0, int w, int h, int r, const Color& c)
+    {
+        list_.record(DisplayOp::RoundRect, c, x0, y0, w, h, nullptr, r > 255 ? 255 : r);
+    }
+
+    void drawFillRoundRect(int x0, int y0, int w, int h, int r, const Color& c)
+    {
+        list_.record(DisplayOp::FillRoundRect, c, x0, y0, w, h, nullptr, r > 255 ? 255 : r);
+    }
+
+    /**
+     * Clip changes are recorded so they apply to the draw calls that follow them when the list is replayed
+    */
+    void setClip(const Rect& r)
+    {
+        Base::setClip(r);
+        list_.record(DisplayOp::SetClip, Color::black(), r.x0, r.y0, r.x1, r.y1);
+    }
+
+    void resetClip()
+    {
+        Base::resetClip();
+        list_.record(DisplayOp::ResetClip, Color::black(), 0, 0);
+    }
+
+    bool pushClip(const Rect& r)
+    {
+        if (!Base::pushClip(r)) return false;
+
+        if (!list_.record(DisplayOp::PushClip, Color::black(), r.x0, r.y0, r.x1, r.y1))
+        {
+            Base::popClip();
+            return false;
+        }
+
+        return true;
+    }
+
+    void popClip()
+    {
+        Base::popClip();
+        list_.record(DisplayOp::PopClip, Color::black(), 0, 0);
+    }
+
+    /**
+     * Font changes are recorded so text is replayed in the font that was set when it was drawn
+    */
+    void setFont(const Font* font)
+    {
+        Base::setFont(font);
+        list_.record(DisplayOp::SetFont, Color::black(), 0, 0, 0, 0, font);
+    }
+
+    /**
+     * Render the recorded draw calls a page at a time and send each page to the panel
+    */
+    void update()
+    {
+        beginUpdate();
+
+        for (auto page = 0u; page < NUM_PAGES; ++page)
+        {
+            updatePage(page);
+        }
+    }
+
+    /**
+     * Start sending a frame. Pages are then sent in order with `updatePage()`
+    */
+    void beginUpdate()
+    {
+        driver_.setWindow(0, NUM_COLUMNS - 1, 0, NUM_PAGES - 1);
+    }
+
+    /**
+     * Render one page of the recorded draw calls into the page buffer and send it to the panel
+    */
+    void updatePage(uint8_t page)
+    {
+        auto& buffer = static_cast<Derived*>(this)->pageBuffer();
+
+        PageRenderTarget<NUM_COLUMNS, GfxReader> target{this->width(), this->height(), buffer};
+        target.setFont(frame_font_);
+
+        buffer.clear();
+        target.setPage(page);
+        list_.replay(target);
+
+        driver_.sendBuffer(buffer.data(), buffer.size());
+    }
+
+    /**
+     * Discard all recorded draw calls and reset the clip region
+    */
+    void clear()
+    {
+        list_.clear();
+        Base::resetClip();
+
+        // Text recorded before the next font change uses the current font
+        frame_font_ = this->font();
+    }
+
+    /**
+     * @return true if draw calls were dropped since the last `clear()` because the display list was full
+    */
+    bool overflowed() const
+    {
+        return list_.overflowed();
+    }
+
+    /**
+     * @return the underlying display driver
+    */
+    drivers::Ssd1306<T, HEIGHT>& getDriver()
+    {
+        return driver_;
+    }
+
+private:
+    DisplayList<N> list_;
+    // Font at the start of the recorded frame
+    const Font* frame_font_;
+
+    drivers::Ssd1306<T, HEIGHT> driver_;
+};
+
+/**
+ * SSD1306 Display Adaptor without a full framebuffer
+ *
+ * Draw calls are recorded into a display list. On `update()` the list is replayed once per page into a single 128 byte
+ * page buffer, which is then sent to the panel. This trades replaying the draw calls for RAM: the display needs the page
+ * buffer plus 13 bytes per recorded command (on AVR) instead of a 1024 byte framebuffer.
+ *
+ * Recorded commands persist across updates, like the contents of a framebuffer. Call `clear()` to start a new frame.
+ * Bitmaps and strings are referenced, not copied, and must remain valid until `update()`.
+ *
+ * \tparam T Panel transport (`drivers::Ssd1306I2C` or `drivers::Ssd1306Spi`)
+ * \tparam GfxReader Method of reading graphics data
+ * \tparam WIDTH Panel width in pixels
+ * \tparam HEIGHT Panel height in pixels
+ * \tparam N Maximum number of draw calls per frame
+*/
+template<typename T, typename GfxReader = memory::DefaultMemoryReader, uint8_t WIDTH = 128, uint8_t HEIGHT = 64,
+         unsigned int N = 16>
+class Ssd1306StreamDisplay
+    : public Ssd1306StreamBase<Ssd1306StreamDisplay<T, GfxReader, WIDTH, HEIGHT, N>, T, GfxReader, WIDTH, HEIGHT, N>
+{
+    using Base = Ssd1306StreamBase<Ssd1306StreamDisplay<T, GfxReader, WIDTH, HEIGHT, N>, T, GfxReader, WIDTH, HEIGHT, N>;
+
+public:
+    using PageBuffer = typename Base::PageBuffer;
+
+    /**
+     * Arguments are forwarded to the transport (e.g. the I2C address)
+    */
+    template<typename... Args>
+    Ssd1306StreamDisplay(Args... args)
+        : Base{args...}
+    {
+    }
+
+    PageBuffer& pageBuffer()
+    {
+        return page_;
+    }
+
+private:
+    PageBuffer page_;
+};
+
+/**
+ * SSD1306 stream display rendering through a page buffer it does not own.
+ *
+ * Behaves like `Ssd1306StreamDisplay`, but pages are rendered into a caller provided buffer. Panels that are updated
+ * one after another can share one buffer, so several panels cost a single 128 byte page buffer between them (see
+ * `Ssd1306PanelGroup`).
+ *
+ *   Ssd1306StreamPanel<Transport>::PageBuffer page;
+ *   Ssd1306StreamPanel<Transport> left{page, 0x3C};
+ *   Ssd1306StreamPanel<Transport> right{page, 0x3D};
+ *
+ * \tparam T Panel transport (`drivers::Ssd1306I2C` or `drivers::Ssd1306Spi`)
+ * \tparam GfxReader Method of reading graphics data
+ * \tparam WIDTH Panel width in pixels
+ * \tparam HEIGHT Panel height in pixels
+ * \tparam N Maximum number of draw calls per frame
+*/
+template<typename T, typename GfxReader = memory::DefaultMemoryReader, uint8_t WIDTH = 128, uint8_t HEIGHT = 64,
+         unsigned int N = 16>
+class Ssd1306StreamPanel
+    : public Ssd1306StreamBase<Ssd1306StreamPanel<T, GfxReader, WIDTH, HEIGHT, N>, T, GfxReader, WIDTH, HEIGHT, N>
+{
+    using Base = Ssd1306StreamBase<Ssd1306StreamPanel<T, GfxReader, WIDTH, HEIGHT, N>, T, GfxReader, WIDTH, HEIGHT, N>;
+
+public:
+    using PageBuffer = typename Base::PageBuffer;
+
+    /**
+     * Remaining arguments are forwarded to the transport (e.g. the I2C address)
+    */
+    template<typename... Args>
+    Ssd1306StreamPanel(PageBuffer& page, Args... args)
+        : Base{args...}
+        , page_{page}
+    {
+    }
+
+    PageBuffer& pageBuffer()
+    {
+        return page_;
+    }
+
+private:
+    PageBuffer& page_;
+};
+
+}
+}
+
+#endif // FTL_GFX_SSD1306_STREAM_DISPLAY_HPP
@@ -0,0 +1,208 @@
+//
+// virtual_display.hpp
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+
+#ifndef FTL_GFX_ADAPTORS_VIRTUAL_DISPLAY_HPP
+#define FTL_GFX_ADAPTORS_VIRTUAL_DISPLAY_HPP
+
+#include <stdint.h>
+
+#include <ftl/gfx/display.hpp>
+#include <ftl/gfx/color.hpp>
+
+namespace ftl
+{
+namespace gfx
+{
+
+/**
+ * Expose a statically dispatched display through the runtime polymorphic `RasterDisplay` interface.
+ *
+ * Each primitive is forwarded to the wrapped display, so display specific fast paths are still used. Only the entry
+ * point is virtual.
+*/
+template<class DisplayT>
+class VirtualDisplay : public RasterDisplay<typename DisplayT::DataReader>
+{
+    using Base = RasterDisplay<typename DisplayT::DataReader>;
+
+public:
+    VirtualDisplay(DisplayT& display)
+        : Base{display.width(), display.height()}
+        , display_{display}
+    {
+        // Start from the wrapped display's font and clip region
+        Base::setFont(display.font());
+        Base::setClip(display.clip());
+    }
+
+    /**
+     * Text is drawn by the wrapped display, so the font is set on both
+    */
+    void setFont(const Font* font) override
+    {
+        Base::setFont(font);
+        display_.setFont(font);
+    }
+
+    void drawPixel(unsigned int col, unsigned int row, const Color& c) override
+    {
+        display_.drawPixel(col, row, c);
+    }
+
+    void update() override
+    {
+        display_.update();
+    }
+
+    void updateRegion(const Rect& area) override
+    {
+        display_.updateRegion(area);
+    }
+
+    void drawLine(int x0, int y0, int x1, int y1, const Color& c) override
+    {
+        display_.drawLine(x0, y0, x1, y1, c);
+    }
+
+    void drawVLine(int x0, int y0, int h, const Color& c) override
+    {
+        display_.drawVLine(x0, y0, h, c);
+    }
+
+    void drawHLine(int x0, int y0, int w, const Color& c) override
+    {
+        display_.drawHLine(x0, y0, w, c);
+    }
+
+    void drawRect(int x0, int y0, int w, int h, const Color& c) override
+    {
+        display_.drawRect(x0, y0, w, h, c);
+    }
+
+    void drawFillRect(int x0, int y0, int w, int h, const Color& c) override
+    {
+        display_.drawFillRect(x0, y0, w, h, c);
+    }
+
+    void drawXBitmap(const uint8_t* const bitmap, int x, int y, int w, int h, const Color& c) override
+    {
+        display_.drawXBitmap(bitmap, x, y, w, h, c);
+    }
+
+    void drawSprite(const uint8_t* const sprite, int x, int y, const Color& c) override
+    {
+        display_.drawSprite(sprite, x, y, c);
+    }
+
+    void drawScaledXBitmap(const uint8_t* const bitmap, int x, int y, int w, int h, uint8_t factor,
+                           const Color& c) override
+    {
+        display_.drawScaledXBitmap(bitmap, x, y, w, h, factor, c);
+    }
+
+    void drawScaledChar(const char ch, int x, int y, uint8_t factor, const Color& c) override
+    {
+        display_.drawScaledChar(ch, x, y, factor, c);
+    }
+
+    void drawScaledString(const char* str, int x, int y, uint8_t factor, const Color& c) override
+    {
+        display_.drawScaledString(str, x, y, factor, c);
+    }
+
+    void drawChar(const char ch, int x, int y, const Color& c) override
+    {
+        display_.drawChar(ch, x, y, c);
+    }
+
+    void drawString(const char* str, int x, int y, const Color& c) override
+    {
+        display_.drawString(str, x, y, c);
+    }
+
+    void drawCircle(int xc, int yc, int r, const Color& c) override
+    {
+        display_.drawCircle(xc, yc, r, c);
+    }
+
+    void drawFillCircle(int xc, int yc, int r, const Color& c) override
+    {
+        display_.drawFillCircle(xc, yc, r, c);
+    }
+
+    void drawArc(int xc, int yc, int r, uint8_t quadrants, const Color& c) override
+    {
+        display_.drawArc(xc, yc, r, quadrants, c);
+    }
+
+    void drawEllipse(int xc, int yc, int rx, int ry, const Color& c) override
+    {
+        display_.drawEllipse(xc, yc, rx, ry, c);
+    }
+
+    void drawFillEllipse(int xc, int yc, int rx, int ry, const Color& c) override
+    {
+        display_.drawFillEllipse(xc, yc, rx, ry, c);
+    }
+
+    void drawRoundRect(int x0, int y0, int w, int h, int r, const Color& c) override
+    {
+        display_.drawRoundRect(x0, y0, w, h, r, c);
+    }
+
+    void drawFillRoundRect(int x0, int y0, int w, int h, int r, const Color& c) override
+    {
+        display_.drawFillRoundRect(x0, y0, w, h, r, c);
+    }
+
+    void setClip(const Rect& r) override
+    {
+        Base::setClip(r);
+        display_.setClip(r);
+    }
+
+    void resetClip() override
+    {
+        Base::resetClip();
+        display_.resetClip();
+    }
+
+    /**
+     * Pushed on both displays or neither, so the clip stacks stay in step
+    */
+    bool pushClip(const Rect& r) override
+    {
+        if (!Base::pushClip(r)) return false;
+
+        if (!display_.pushClip(r))
+        {
+            Base::popClip();
+            return false;
+        }
+
+        return true;
+    }
+
+    void popClip() override
+    {
+        Base::popClip();
+        display_.popClip();
+    }
+
+    DisplayT& getDisplay()
+    {
+        return display_;
+    }
+
+private:
+    DisplayT& display_;
+};
+
+}
+}
+
+#endif // FTL_GFX_ADAPTORS_VIRTUAL_DISPLAY_HPP
@@ -15,48 +15,48 @@ namespace gfx
 {
     struct Color
     {
-        Color(uint8_t r, uint8_t g, uint8_t b)
+        constexpr Color(uint8_t r, uint8_t g, uint8_t b)
             : r{r}, g{g}, b{b}
         {
         }
 
-        Color(uint8_t v) : Color{v, v, v}
+        constexpr Color(uint8_t v) : Color{v, v, v}
         {
         }
 
-        Color() : Color{0}
+        constexpr Color() : Color{0}
         {
         }
 
-        uint8_t monochrome() const
+        constexpr uint8_t monochrome() const
         {
             // If the Color is not (0, 0, 0) return 1
-            return (r != 0 && g != 0 && b != 0);
+            return (r | g | b) != 0;
         }
 
         /* Color constants */
 
-        static Color black()
+        static constexpr Color black()
         {
             return Color{};
         }
 
-        static Color white()
+        static constexpr Color white()
         {
             return Color{255, 255, 255};
         }
 
-        static Color red()
+        static constexpr Color red()
         {
             return Color{255, 0, 0};
         }
 
-        static Color green()
+        static constexpr Color green()
         {
             return Color{0, 255, 0};
         }
 
-        static Color blue()
+        static constexpr Color blue()
         {
             return Color{0, 0, 255};
         }
@@ -10,7 +10,12 @@
 #include <ftl/gfx/color.hpp>
 #include <ftl/memory/memreader.hpp>
 #include <ftl/gfx/font.hpp>
+#include <ftl/gfx/pixel_format.hpp>
+#include <ftl/gfx/rect.hpp>
+#include <ftl/gfx/scale.hpp>
+#include <ftl/gfx/sprite.hpp>
 
+#include <stdint.h>
 // FIXME: Can I assume this header exists?
 #include <stdlib.h>
 
@@ -19,141 +24,307 @@ namespace ftl
 namespace gfx
 {
     /**
-     * Abstraction for raster displays.
-     * 
-     * Implementors must provide a method of setting a single pixel and a method to update the display.
-     * All other functions can be overridden for display specific optimizations.
-     * 
+     * Statically dispatched base for raster displays.
+     *
+     * Derived displays provide `drawPixel(col, row, color)` and `update()`. All drawing primitives are resolved against
+     * the derived type at compile time (CRTP), so calls to `drawPixel` and to any primitive the derived class shadows
+     * (e.g. a faster `drawHLine` or `drawFillRect`) are direct and can be inlined.
+     *
+     * All primitives are clipped to the current clip region, which defaults to the whole display. Nested regions can be
+     * pushed and popped. Primitives that are completely outside the clip region are rejected without being walked, so
+     * pixels are only ever written inside the clip region. Derived classes that shadow a primitive must clip it
+     * themselves (see `clipRect()`).
+     *
+     * Primitives convert their `Color` once, to the display's `PixelFormat` (see `gfx/pixel_format.hpp`), and write
+     * pixels with `writePixel(x, y, pixel)`. The default format passes `Color` through to `drawPixel`. Displays with a
+     * native format shadow `PixelFormat` and `writePixel` so inner loops work on packed values.
+     *
+     * Derived       - The concrete display type
      * GfxDataReader - Because graphics data may be stored in a variety of ways on an embedded platform, provide a method
      *                 for different targets to override how data is read (e.g. from flash)
     */
-    template<class GfxDataReader = memory::DefaultMemoryReader>
-    class RasterDisplay
+    template<class Derived, class GfxDataReader = memory::DefaultMemoryReader>
+    class StaticRasterDisplay
     {
     public:
-        RasterDisplay(unsigned int width, unsigned int height)
+        using DataReader = GfxDataReader;
+        using PixelFormat = ColorFormat;
+
+        // Number of clip regions that can be pushed
+        static constexpr uint8_t CLIP_STACK_DEPTH = 4;
+
+        // Quadrants selected for `drawArc()`
+        static constexpr uint8_t QUADRANT_TOP_RIGHT = 0x01;
+        static constexpr uint8_t QUADRANT_TOP_LEFT = 0x02;
+        static constexpr uint8_t QUADRANT_BOTTOM_LEFT = 0x04;
+        static constexpr uint8_t QUADRANT_BOTTOM_RIGHT = 0x08;
+        static constexpr uint8_t QUADRANT_ALL = 0x0F;
+
+        StaticRasterDisplay(unsigned int width, unsigned int height)
             : width_{width}, height_{height}
+            , clip_{0, 0, static_cast<int>(width) - 1, static_cast<int>(height) - 1}
+            , clip_depth_{0}
         {
         }
 
-        ~RasterDisplay() = default;
-
-        /**
-         * Set a pixel in the display
-        */
-        virtual void drawPixel(unsigned int col, unsigned int row, const Color& c) = 0;
+        ~StaticRasterDisplay() = default;
 
         /**
-         * Update the display
+         * Write a pixel value in the display's `PixelFormat`. The position is not checked, primitives only call this for
+         * pixels inside the clip region
         */
-        virtual void update() = 0;
+        void writePixel(int x, int y, const Color& c)
+        {
+            derived().drawPixel(x, y, c);
+        }
 
         /**
          * Draw a line
-         * 
+         *
          * Implements Bresenham's algorithm https://en.wikipedia.org/wiki/Bresenham%27s_line_algorithm
+         *
+         * Lines with both end points beyond the same edge of the clip region are rejected from their outcodes
+         * (Cohen-Sutherland). Otherwise only the visible steps are walked, see `drawLineSteps()`.
+         *
+         * Coordinates must be within [-16384, 16383] so the clipping arithmetic fits in 32 bits.
         */
-        virtual void drawLine(int x0, int y0, int x1, int y1, const Color& c)
+        void drawLine(int x0, int y0, int x1, int y1, const Color& c)
         {
-            const auto dx = abs(x1 - x0);
+            if (outcode(x0, y0) & outcode(x1, y1)) return;
+
+            const auto p = native(c);
+            const long dx = labs(static_cast<long>(x1) - x0);
+            const long dy = labs(static_cast<long>(y1) - y0);
             const auto sx = x0 < x1 ? 1 : -1;
-            const auto dy = -abs(y1 - y0);
             const auto sy = y0 < y1 ? 1 : -1;
 
-            auto err = dx + dy;
-
-            while (true)
+            if (dx >= dy)
             {
-                drawPixel(x0, y0, c);
-                // Check if at the end of the line
-                if (x0 == x1 && y0 == y1) break;
-
-                const auto e2 = 2 * err;
-                if (e2 >= dy)
-                {
-                    err += dy;
-                    x0 += sx;
-                }
-
-                if (e2 <= dx)
-                {
-                    err += dx;
-                    y0 += sy;
-                }
+                drawLineSteps<false>(x0, y0, sx, sy, dx, dy, clip_.x0, clip_.x1, clip_.y0, clip_.y1, p);
+            }
+            else
+            {
+                drawLineSteps<true>(y0, x0, sy, sx, dy, dx, clip_.y0, clip_.y1, clip_.x0, clip_.x1, p);
             }
-            
         }
 
         /**
          * Draw a vertical line
         */
-        virtual void drawVLine(int x0, int y0, int h, const Color& c)
+        void drawVLine(int x0, int y0, int h, const Color& c)
         {
-            drawLine(x0, y0, x0, y0 + h, c);
+            derived().drawLine(x0, y0, x0, y0 + h, c);
         }
 
         /**
          * Draw a horizontal line
         */
-        virtual void drawHLine(int x0, int y0, int w, const Color& c)
+        void drawHLine(int x0, int y0, int w, const Color& c)
         {
-            drawLine(x0, y0, x0 + w, y0, c);
+            derived().drawLine(x0, y0, x0 + w, y0, c);
         }
 
         /**
          * Draw a rectangle
         */
-        virtual void drawRect(int x0, int y0, int w, int h, const Color& c)
+        void drawRect(int x0, int y0, int w, int h, const Color& c)
         {
+            // Reject rectangles entirely outside the clip region, the edges clip themselves
+            int cx0 = x0;
+            int cy0 = y0;
+            int cx1 = x0 + w;
+            int cy1 = y0 + h;
+            if (!clipRect(cx0, cy0, cx1, cy1)) return;
+
             // Draw top
-            drawHLine(x0, y0, w, c);
+            derived().drawHLine(x0, y0, w, c);
             // Draw bottom
-            drawHLine(x0, y0 + h, w, c);
+            derived().drawHLine(x0, y0 + h, w, c);
             // Draw left
-            drawVLine(x0, y0, h, c);
+            derived().drawVLine(x0, y0, h, c);
             // Draw right
-            drawVLine(x0 + w, y0, h, c);
+            derived().drawVLine(x0 + w, y0, h, c);
         }
 
         /**
          * Draw fill rectangle
         */
-        virtual void drawFillRect(int x0, int y0, int w, int h, const Color& c)
+        void drawFillRect(int x0, int y0, int w, int h, const Color& c)
         {
-            const auto x1 = x0 + w;
-            const auto y1 = y0 + h;
+            if (w < 0 || h < 0) return;
+
+            int x1 = x0 + w;
+            int y1 = y0 + h;
+            if (!clipRect(x0, y0, x1, y1)) return;
+
+            const auto p = native(c);
+
             for (auto x = x0; x <= x1; ++x)
             {
                 for (auto y = y0; y <= y1; ++y)
                 {
-                    drawPixel(x, y, c);
+                    derived().writePixel(x, y, p);
                 }
             }
         }
 
-        // /**
-        //  * Draw circle
-        // */
-        // virtual void drawCircle(int xc, int yc, int r, const Color& c)
-        // {
-        //     const auto x = 0;
-        //     const auto y = r;
-        // }
+        /**
+         * Draw a circle outline (midpoint algorithm)
+        */
+        void drawCircle(int xc, int yc, int r, const Color& c)
+        {
+            drawArc(xc, yc, r, QUADRANT_ALL, c);
+        }
 
         /**
-         * Draw a bitmap in XBITMAP format
+         * Draw the quadrants of a circle outline selected by `quadrants` (QUADRANT_* flags)
         */
-        virtual void drawXBitmap(const uint8_t* const bitmap, int x, int y, int w, int h, const Color& c)
+        void drawArc(int xc, int yc, int r, uint8_t quadrants, const Color& c)
         {
-            const auto bytes_per_row = w / 8;
+            if (r < 0 || !boundsVisible(xc - r, yc - r, xc + r, yc + r)) return;
+            drawCorners(xc, yc, xc, yc, r, quadrants, native(c));
+        }
 
-            for (auto j = 0; j < h; ++j)
+        /**
+         * Draw a filled circle. The circle is filled with horizontal spans
+        */
+        void drawFillCircle(int xc, int yc, int r, const Color& c)
+        {
+            if (r < 0 || !boundsVisible(xc - r, yc - r, xc + r, yc + r)) return;
+            fillCorners(xc, yc, xc, yc, r, c);
+        }
+
+        /**
+         * Draw an ellipse outline with radii rx and ry (midpoint algorithm). Radii must be at most 512
+        */
+        void drawEllipse(int xc, int yc, int rx, int ry, const Color& c)
+        {
+            if (rx < 0 || ry < 0 || !boundsVisible(xc - rx, yc - ry, xc + rx, yc + ry)) return;
+
+            if (rx == 0 || ry == 0)
             {
-                const auto row = y + j;
-                uint8_t byte = 0;
+                // Flat ellipses are lines
+                derived().drawLine(xc - rx, yc - ry, xc + rx, yc + ry, c);
+                return;
+            }
 
-                for (auto i = 0; i < w; ++i)
+            const auto p = native(c);
+
+            walkEllipse(rx, ry, [&](int x, int y, bool)
+            {
+                plot(xc + x, yc + y, p);
+                plot(xc - x, yc + y, p);
+                plot(xc + x, yc - y, p);
+                plot(xc - x, yc - y, p);
+            });
+        }
+
+        /**
+         * Draw a filled ellipse. The ellipse is filled with horizontal spans. Radii must be at most 512
+        */
+        void drawFillEllipse(int xc, int yc, int rx, int ry, const Color& c)
+        {
+            if (rx < 0 || ry < 0 || !boundsVisible(xc - rx, yc - ry, xc + rx, yc + ry)) return;
+
+            if (rx == 0 || ry == 0)
+            {
+                derived().drawLine(xc - rx, yc - ry, xc + rx, yc + ry, c);
+                return;
+            }
+
+            walkEllipse(rx, ry, [&](int x, int y, bool last)
+            {
+                // Only the widest point of each row is filled
+                if (!last) return;
+
+                derived().drawHLine(xc - x, yc - y, 2 * x, c);
+                if (y != 0)
+                {
+                    derived().drawHLine(xc - x, yc + y, 2 * x, c);
+                }
+            });
+        }
+
+        /**
+         * Draw a rectangle with corners rounded to radius r. The radius is limited to half the shorter side
+        */
+        void drawRoundRect(int x0, int y0, int w, int h, int r, const Color& c)
+        {
+            if (w < 0 || h < 0 || !boundsVisible(x0, y0, x0 + w, y0 + h)) return;
+
+            r = limitRadius(w, h, r);
+
+            // Corner centres
+            const auto cx0 = x0 + r;
+            const auto cy0 = y0 + r;
+            const auto cx1 = x0 + w - r;
+            const auto cy1 = y0 + h - r;
+
+            derived().drawHLine(cx0, y0, cx1 - cx0, c);
+            derived().drawHLine(cx0, y0 + h, cx1 - cx0, c);
+            derived().drawVLine(x0, cy0, cy1 - cy0, c);
+            derived().drawVLine(x0 + w, cy0, cy1 - cy0, c);
+
+            drawCorners(cx0, cy0, cx1, cy1, r, QUADRANT_ALL, native(c));
+        }
+
+        /**
+         * Draw a filled rectangle with corners rounded to radius r. The radius is limited to half the shorter side
+        */
+        void drawFillRoundRect(int x0, int y0, int w, int h, int r, const Color& c)
+        {
+            if (w < 0 || h < 0 || !boundsVisible(x0, y0, x0 + w, y0 + h)) return;
+
+            r = limitRadius(w, h, r);
+
+            const auto cy0 = y0 + r;
+            const auto cy1 = y0 + h - r;
+
+            // Rows between the corners
+            if (cy1 - cy0 >= 2)
+            {
+                derived().drawFillRect(x0, cy0 + 1, w, cy1 - cy0 - 2, c);
+            }
+
+            fillCorners(x0 + r, cy0, x0 + w - r, cy1, r, c);
+        }
+
+        /**
+         * Draw a bitmap in XBITMAP format. Rows are padded to a whole number of bytes.
+         *
+         * Only the rows and bytes of the bitmap inside the clip region are read.
+        */
+        void drawXBitmap(const uint8_t* const bitmap, int x, int y, int w, int h, const Color& c)
+        {
+            const auto area = clip_.intersect(Rect{x, y, x + w - 1, y + h - 1});
+            if (area.empty()) return;
+
+            // Visible bitmap columns and rows
+            const auto i0 = area.x0 - x;
+            const auto i1 = area.x1 - x;
+            const auto j0 = area.y0 - y;
+            const auto j1 = area.y1 - y;
+
+            const auto bytes_per_row = (w + 7) / 8;
+            const auto bytes_read = i1 / 8 - i0 / 8 + 1;
+
+            const auto p = native(c);
+            auto cursor = gfx_reader_.cursor(bitmap, j0 * bytes_per_row + i0 / 8);
+
+            for (auto j = j0; j <= j1; ++j)
+            {
+                // 1 bit per column pixel, LSB first
+                uint8_t byte = cursor.next() >> (i0 & 7);
+
+                for (auto i = i0; ; )
                 {
+                    if (byte & 0x01)
+                    {
+                        derived().writePixel(x + i, y + j, p);
+                    }
+
+                    if (++i > i1) break;
+
                     if (i & 7)
                     {
                         // Processing a byte, shift 1 down to the next pixel
@@ -161,21 +332,41 @@ namespace gfx
                     }
                     else
                     {
-                        // New byte
-                        // Skip bytes until the current row + byte offset for columns (1 bit per column pixel)
-                        byte = gfx_reader_(bitmap, j * bytes_per_row + i / 8);
+                        byte = cursor.next();
                     }
+                }
 
-                    if (byte & 0x01)
+                // Move to the first visible byte of the next row
+                cursor.skip(bytes_per_row - bytes_read);
+            }
+        }
+
+        /**
+         * Draw a run length encoded sprite (see `gfx/sprite.hpp`). Set pixels are drawn with `c`, the rest is transparent
+        */
+        void drawSprite(const uint8_t* const sprite, int x, int y, const Color& c)
+        {
+            const Rect bounds{x, y, x + sprite::width(sprite, gfx_reader_) - 1, y + sprite::height(sprite, gfx_reader_) - 1};
+            if (clip_.intersect(bounds).empty()) return;
+
+            const auto p = native(c);
+
+            sprite::decode(sprite, gfx_reader_, [&](uint8_t col, uint8_t page_row, uint8_t bits)
+            {
+                const auto row = y + page_row * 8;
+
+                for (auto i = 0; bits; ++i, bits >>= 1)
+                {
+                    if ((bits & 0x01) && clip_.contains(x + col, row + i))
                     {
-                        drawPixel(x + i, row, c);
+                        derived().writePixel(x + col, row + i, p);
                     }
                 }
-            }
+            });
         }
 
         /**
-         * Draw a string
+         * Draw a string. Characters advance by their width in proportional (`Packed`) fonts
         */
         void drawString(const char* str, int x, int y, const gfx::Color& color)
         {
@@ -197,8 +388,8 @@ namespace gfx
                 }
                 else
                 {
-                    drawChar(c, x, y, color);
-                    x += font_->width();
+                    derived().drawChar(c, x, y, color);
+                    x += font_->advance(c, gfx_reader_);
                 }
             }
         }
@@ -210,22 +401,124 @@ namespace gfx
         {
             if (!font_) return;
 
-            for (auto i = 0; i < font_->width(); ++i)
+            if (font_->layout() == FontLayout::Packed)
+            {
+                drawPackedChar(c, x, y, color);
+                return;
+            }
+
+            const auto area = clip_.intersect(Rect{x, y, x + static_cast<int>(font_->width()) - 1,
+                                                   y + static_cast<int>(font_->height()) - 1});
+            if (area.empty()) return;
+
+            // Copy the glyph out in one block read
+            uint8_t glyph[8];
+            gfx_reader_.read(glyph, font_->data() + font_->offset(c), sizeof(glyph));
+
+            const bool pages = font_->layout() == FontLayout::Pages;
+            const auto fg = native(color);
+            const auto bg = native(Color::black());
+
+            for (auto i = area.x0 - x; i <= area.x1 - x; ++i)
             {
-                for (auto j = 0; j < font_->height(); ++j)
+                for (auto j = area.y0 - y; j <= area.y1 - y; ++j)
                 {
-                    if (font_->at(c, i, j, gfx_reader_))
-                    {
-                        drawPixel(x + i, y + j, color);
-                    }
-                    else
+                    const auto set = pages ? (glyph[i] >> j) & 0x01 : (glyph[j] >> i) & 0x01;
+
+                    derived().writePixel(x + i, y + j, set ? fg : bg);
+                }
+            }
+        }
+
+        /**
+         * Draw a bitmap in XBITMAP format scaled by an integer factor (1 to `scale::MAX_FACTOR`). Set pixels are drawn as
+         * factor x factor blocks with `c`, the rest is transparent
+        */
+        void drawScaledXBitmap(const uint8_t* const bitmap, int x, int y, int w, int h, uint8_t factor, const Color& c)
+        {
+            if (factor == 0 || factor > scale::MAX_FACTOR) return;
+            if (!boundsVisible(x, y, x + w * factor - 1, y + h * factor - 1)) return;
+
+            const auto p = native(c);
+            auto cursor = gfx_reader_.cursor(bitmap);
+
+            for (auto j = 0; j < h; ++j)
+            {
+                // Rows are padded to whole bytes, so each row starts with a new byte
+                uint8_t byte = 0;
+                for (auto i = 0; i < w; ++i)
+                {
+                    byte = (i & 7) ? byte >> 1 : cursor.next();
+
+                    if (byte & 0x01)
                     {
-                        drawPixel(x + i, y + j, gfx::Color::black());
+                        fillBlock(x + i * factor, y + j * factor, factor, p);
                     }
                 }
             }
         }
 
+        /**
+         * Draw a string scaled by an integer factor (1 to `scale::MAX_FACTOR`)
+        */
+        void drawScaledString(const char* str, int x, int y, uint8_t factor, const gfx::Color& color)
+        {
+            if (!font_) return;
+
+            while(*str)
+            {
+                const char c = *str++;
+
+                if (c == '\n')
+                {
+                    x = 0;
+                    y = (y + font_->height() * factor) % height_;
+                }
+                else if (c == '\r')
+                {
+                    x = 0;
+                    y = 0;
+                }
+                else
+                {
+                    derived().drawScaledChar(c, x, y, factor, color);
+                    x += font_->advance(c, gfx_reader_) * factor;
+                }
+            }
+        }
+
+        /**
+         * Draw a character from the set font scaled by an integer factor (1 to `scale::MAX_FACTOR`). Each glyph pixel is
+         * a factor x factor block
+        */
+        void drawScaledChar(const char c, int x, int y, uint8_t factor, const gfx::Color& color)
+        {
+            if (!font_ || factor == 0 || factor > scale::MAX_FACTOR) return;
+
+            // The widest glyph bounds every glyph
+            if (!boundsVisible(x, y, x + font_->width() * factor - 1, y + font_->height() * factor - 1)) return;
+
+            const auto fg = native(color);
+            const auto bg = native(Color::black());
+
+            decodeGlyph(c, [&](int i, int row, uint8_t bits, uint8_t n)
+            {
+                for (uint8_t k = 0; k < n; ++k)
+                {
+                    fillBlock(x + i * factor, y + (row + k) * factor, factor, ((bits >> k) & 0x01) ? fg : bg);
+                }
+            });
+        }
+
+        /**
+         * Update the part of the display covering `area`. Displays that can send part of a frame shadow this, the
+         * default updates the whole display
+        */
+        void updateRegion(const Rect& /* area */)
+        {
+            derived().update();
+        }
+
         /**
          * Set the font the display uses
         */
@@ -249,11 +542,671 @@ namespace gfx
             return font_;
         }
 
+        /**
+         * Set the clip region. It is limited to the display bounds
+        */
+        void setClip(const Rect& r)
+        {
+            clip_ = bounds().intersect(r);
+        }
+
+        /**
+         * Clip to the whole display and empty the clip stack
+        */
+        void resetClip()
+        {
+            clip_ = bounds();
+            clip_depth_ = 0;
+        }
+
+        /**
+         * Save the clip region and clip to its intersection with `r`.
+         *
+         * Returns false, leaving the clip region unchanged, if the stack is full.
+        */
+        bool pushClip(const Rect& r)
+        {
+            if (clip_depth_ >= CLIP_STACK_DEPTH) return false;
+
+            clip_stack_[clip_depth_++] = clip_;
+            clip_ = clip_.intersect(r);
+
+            return true;
+        }
+
+        /**
+         * Restore the clip region saved by the last `pushClip()`
+        */
+        void popClip()
+        {
+            if (clip_depth_ > 0)
+            {
+                clip_ = clip_stack_[--clip_depth_];
+            }
+        }
+
+        const Rect& clip() const
+        {
+            return clip_;
+        }
+
+    protected:
+        Derived& derived()
+        {
+            return *static_cast<Derived*>(this);
+        }
+
+        /**
+         * Sort the corners of an inclusive rectangle and clip it to the clip region. Returns false if nothing is visible
+        */
+        bool clipRect(int& x0, int& y0, int& x1, int& y1) const
+        {
+            if (x0 > x1) swap(x0, x1);
+            if (y0 > y1) swap(y0, y1);
+
+            if (x0 < clip_.x0) x0 = clip_.x0;
+            if (y0 < clip_.y0) y0 = clip_.y0;
+            if (x1 > clip_.x1) x1 = clip_.x1;
+            if (y1 > clip_.y1) y1 = clip_.y1;
+
+            return x0 <= x1 && y0 <= y1;
+        }
+
+        const GfxDataReader& reader() const
+        {
+            return gfx_reader_;
+        }
+
+        /**
+         * Decode the glyph of a character from the set font a column at a time. `fn(col, row, bits, n)` is called with
+         * n (1 to 8) pixels of glyph column `col` starting at glyph row `row`, LSB at the top. The spacing columns of
+         * packed fonts are included as blank columns. Returns false if the font has no glyph for the character
+        */
+        template<class Fn>
+        bool decodeGlyph(char c, Fn fn) const
+        {
+            if (font_->layout() == FontLayout::Packed)
+            {
+                Glyph glyph;
+                if (!font_->glyph(c, glyph, gfx_reader_)) return false;
+
+                const int h = font_->height();
+                auto bits = font_->bits(glyph, gfx_reader_);
+
+                for (auto i = 0; i < glyph.advance; ++i)
+                {
+                    for (auto row = 0; row < h; row += 8)
+                    {
+                        const uint8_t n = h - row < 8 ? h - row : 8;
+                        fn(i, row, i < glyph.width ? bits.next(n) : 0, n);
+                    }
+                }
+
+                return true;
+            }
+
+            uint8_t glyph[8];
+            gfx_reader_.read(glyph, font_->data() + font_->offset(c), sizeof(glyph));
+
+            const bool pages = font_->layout() == FontLayout::Pages;
+
+            for (auto i = 0; i < 8; ++i)
+            {
+                uint8_t column = glyph[i];
+
+                if (!pages)
+                {
+                    // Gather column i from the rows
+                    column = 0;
+                    for (auto j = 0; j < 8; ++j)
+                    {
+                        column |= ((glyph[j] >> i) & 0x01) << j;
+                    }
+                }
+
+                fn(i, 0, column, 8);
+            }
+
+            return true;
+        }
+
     private:
-        GfxDataReader gfx_reader_;
+        static void swap(int& a, int& b)
+        {
+            const auto t = a;
+            a = b;
+            b = t;
+        }
+
+        Rect bounds() const
+        {
+            return Rect{0, 0, static_cast<int>(width_) - 1, static_cast<int>(height_) - 1};
+        }
+
+        /**
+         * Check if any part of the bounding box (x0, y0) - (x1, y1) is inside the clip region
+        */
+        bool boundsVisible(int x0, int y0, int x1, int y1) const
+        {
+            return !clip_.intersect(Rect{x0, y0, x1, y1}).empty();
+        }
+
+        /**
+         * Convert a colour to the native pixel value of the derived display
+        */
+        static auto native(const Color& c)
+        {
+            return Derived::PixelFormat::fromColor(c);
+        }
+
+        /**
+         * Write a native pixel if it is inside the clip region
+        */
+        template<typename Pixel>
+        void plot(int x, int y, const Pixel& p)
+        {
+            if (clip_.contains(x, y))
+            {
+                derived().writePixel(x, y, p);
+            }
+        }
+
+        /**
+         * Draw a character of a packed font. The glyph bits are read in order and the spacing columns after the glyph
+         * are drawn as background
+        */
+        void drawPackedChar(const char c, int x, int y, const gfx::Color& color)
+        {
+            Glyph glyph;
+            if (!font_->glyph(c, glyph, gfx_reader_)) return;
+
+            const int h = font_->height();
+            const auto area = clip_.intersect(Rect{x, y, x + glyph.advance - 1, y + h - 1});
+            if (area.empty()) return;
+
+            const auto fg = native(color);
+            const auto bg = native(Color::black());
+            auto bits = font_->bits(glyph, gfx_reader_);
+
+            for (auto i = 0; x + i <= area.x1; ++i)
+            {
+                for (auto j = 0; j < h; ++j)
+                {
+                    const bool set = i < glyph.width && bits.next(1);
+
+                    if (x + i >= area.x0 && y + j >= area.y0 && y + j <= area.y1)
+                    {
+                        derived().writePixel(x + i, y + j, set ? fg : bg);
+                    }
+                }
+            }
+        }
+
+        /**
+         * Fill the part of a size x size block inside the clip region with a native pixel
+        */
+        template<typename Pixel>
+        void fillBlock(int x, int y, uint8_t size, const Pixel& p)
+        {
+            const auto area = clip_.intersect(Rect{x, y, x + size - 1, y + size - 1});
+
+            for (auto i = area.x0; i <= area.x1; ++i)
+            {
+                for (auto j = area.y0; j <= area.y1; ++j)
+                {
+                    derived().writePixel(i, j, p);
+                }
+            }
+        }
+
+        static int limitRadius(int w, int h, int r)
+        {
+            const auto shorter = w < h ? w : h;
+            if (r > shorter / 2) r = shorter / 2;
+            if (r < 0) r = 0;
+
+            return r;
+        }
+
+        /**
+         * Walk one octant of a circle of radius r with the midpoint algorithm, calling `fn(x, y)` for each point with
+         * 0 <= x <= y
+        */
+        template<class Fn>
+        static void walkCircle(int r, Fn fn)
+        {
+            int x = 0;
+            int y = r;
+            int d = 1 - r;
+
+            while (x <= y)
+            {
+                fn(x, y);
+
+                ++x;
+                if (d < 0)
+                {
+                    d += 2 * x + 1;
+                }
+                else
+                {
+                    --y;
+                    d += 2 * (x - y) + 1;
+                }
+            }
+        }
+
+        /**
+         * Draw quarter circle outlines of radius r. The right quadrants are centred on cx1 and the left on cx0, the top
+         * on cy0 and the bottom on cy1, so the corners of a rounded rectangle are drawn the same way as a circle.
+        */
+        template<typename Pixel>
+        void drawCorners(int cx0, int cy0, int cx1, int cy1, int r, uint8_t quadrants, const Pixel& p)
+        {
+            walkCircle(r, [&](int x, int y)
+            {
+                // Each quadrant is two octants, the second is the first mirrored about the diagonal
+                for (auto i = 0; i < 2; ++i)
+                {
+                    if (quadrants & QUADRANT_TOP_RIGHT) plot(cx1 + x, cy0 - y, p);
+                    if (quadrants & QUADRANT_TOP_LEFT) plot(cx0 - x, cy0 - y, p);
+                    if (quadrants & QUADRANT_BOTTOM_LEFT) plot(cx0 - x, cy1 + y, p);
+                    if (quadrants & QUADRANT_BOTTOM_RIGHT) plot(cx1 + x, cy1 + y, p);
+
+                    if (x == y) break;
+                    swap(x, y);
+                }
+            });
+        }
+
+        /**
+         * Fill the area enclosed by `drawCorners()` above cy0 and below cy1 with horizontal spans from cx0 - x to cx1 + x
+        */
+        void fillCorners(int cx0, int cy0, int cx1, int cy1, int r, const Color& c)
+        {
+            const auto span = [&](int x, int y)
+            {
+                derived().drawHLine(cx0 - x, cy0 - y, cx1 - cx0 + 2 * x, c);
+                if (cy1 + y != cy0 - y)
+                {
+                    derived().drawHLine(cx0 - x, cy1 + y, cx1 - cx0 + 2 * x, c);
+                }
+            };
+
+            int last_x = 0;
+            int last_y = r;
+
+            walkCircle(r, [&](int x, int y)
+            {
+                // Rows +/- x are visited once, at their widest point y
+                span(y, x);
+
+                if (y != last_y)
+                {
+                    // The walk left rows +/- last_y, their widest point was last_x. Skip them if they were also an x row
+                    if (last_y > last_x) span(last_x, last_y);
+                    last_y = y;
+                }
+
+                last_x = x;
+            });
+
+            if (last_y > last_x) span(last_x, last_y);
+        }
+
+        /**
+         * Walk one quadrant of an ellipse with integer midpoint steps (J. Kennedy, "A Fast Bresenham Type Algorithm For
+         * Drawing Ellipses"), calling `fn(x, y, last)` for each point. `last` is set on the widest point of each row.
+         * Both radii must be greater than zero.
+        */
+        template<class Fn>
+        static void walkEllipse(long rx, long ry, Fn fn)
+        {
+            const long two_a2 = 2 * rx * rx;
+            const long two_b2 = 2 * ry * ry;
+
+            // Region 1, y steps every point
+            long x = rx;
+            long y = 0;
+            long x_change = ry * ry * (1 - 2 * rx);
+            long y_change = rx * rx;
+            long error = 0;
+            long stop_x = two_b2 * rx;
+            long stop_y = 0;
+
+            while (stop_x >= stop_y)
+            {
+                fn(x, y, true);
+
+                ++y;
+                stop_y += two_a2;
+                error += y_change;
+                y_change += two_a2;
+
+                if (2 * error + x_change > 0)
+                {
+                    --x;
+                    stop_x -= two_b2;
+                    error += x_change;
+                    x_change += two_b2;
+                }
+            }
+
+            // Region 2, x steps every point
+            x = 0;
+            y = ry;
+            x_change = ry * ry;
+            y_change = rx * rx * (1 - 2 * ry);
+            error = 0;
+            stop_x = 0;
+            stop_y = two_a2 * ry;
+
+            while (stop_x <= stop_y)
+            {
+                const long px = x;
+                const long py = y;
+
+                ++x;
+                stop_x += two_b2;
+                error += x_change;
+                x_change += two_b2;
+
+                const bool step_y = 2 * error + y_change > 0;
+                if (step_y)
+                {
+                    --y;
+                    stop_y -= two_a2;
+                    error += y_change;
+                    y_change += two_a2;
+                }
+
+                fn(px, py, step_y || stop_x > stop_y);
+            }
+        }
+
+        /**
+         * Cohen-Sutherland outcode of a point against the clip region
+        */
+        uint8_t outcode(int x, int y) const
+        {
+            uint8_t code = 0;
+
+            if (x < clip_.x0) code |= 0x01;
+            else if (x > clip_.x1) code |= 0x02;
+
+            if (y < clip_.y0) code |= 0x04;
+            else if (y > clip_.y1) code |= 0x08;
+
+            return code;
+        }
+
+        /**
+         * Draw the visible part of a line by stepping along its major axis.
+         *
+         * After k steps the minor axis has moved floor((2 * d_minor * k + d_major) / (2 * d_major)) pixels, which is the
+         * pixel Bresenham's algorithm picks. Solving that for the clip edges gives the first and last visible step, so
+         * the line is clipped exactly (Liang-Barsky in integer step space) and off-screen steps are never walked.
+         *
+         * The minor axis is x when SWAP is set.
+        */
+        template<bool SWAP, typename Pixel>
+        void drawLineSteps(int major, int minor, int s_major, int s_minor, long d_major, long d_minor,
+                           int clip_major0, int clip_major1, int clip_minor0, int clip_minor1, const Pixel& p)
+        {
+            // Steps where the major axis is inside the clip region
+            long k0 = (s_major > 0) ? static_cast<long>(clip_major0) - major : static_cast<long>(major) - clip_major1;
+            long k1 = (s_major > 0) ? static_cast<long>(clip_major1) - major : static_cast<long>(major) - clip_major0;
+            if (k0 < 0) k0 = 0;
+            if (k1 > d_major) k1 = d_major;
+
+            // Minor axis offsets inside the clip region
+            const long m0 = (s_minor > 0) ? static_cast<long>(clip_minor0) - minor
+                                          : static_cast<long>(minor) - clip_minor1;
+            const long m1 = (s_minor > 0) ? static_cast<long>(clip_minor1) - minor
+                                          : static_cast<long>(minor) - clip_minor0;
+            if (m0 > d_minor || m1 < 0) return;
+
+            const long two_major = 2 * d_major;
+            const long two_minor = 2 * d_minor;
+
+            // First step with an offset of at least m0
+            if (m0 > 0)
+            {
+                const long k = (two_major * m0 - d_major + two_minor - 1) / two_minor;
+                if (k > k0) k0 = k;
+            }
+
+            // Last step with an offset of at most m1
+            if (m1 < d_minor)
+            {
+                const long k = (two_major * (m1 + 1) - d_major - 1) / two_minor;
+                if (k < k1) k1 = k;
+            }
+
+            if (k0 > k1) return;
+
+            // Minor axis offset and error term at the first visible step
+            long m = 0;
+            long r = d_major;
+            if (k0 > 0)
+            {
+                const long num = two_minor * k0 + d_major;
+                m = num / two_major;
+                r = num % two_major;
+            }
+
+            const int a = major + s_major * static_cast<int>(k0);
+            const int b = minor + s_minor * static_cast<int>(m);
+            const int n = static_cast<int>(k1 - k0);
+
+            // The error term peaks at two_major - 1 + two_minor. Keep it in 16 bits when that cannot overflow
+            if (two_major + two_minor <= INT16_MAX)
+            {
+                walkLine<SWAP, int16_t>(a, b, s_major, s_minor, n, r, two_minor, two_major, p);
+            }
+            else
+            {
+                walkLine<SWAP, long>(a, b, s_major, s_minor, n, r, two_minor, two_major, p);
+            }
+        }
+
+        /**
+         * Draw n + 1 steps of a line from (a, b) in major / minor axis coordinates
+        */
+        template<bool SWAP, typename ErrorT, typename Pixel>
+        void walkLine(int a, int b, int s_major, int s_minor, int n, ErrorT r, ErrorT two_minor, ErrorT two_major,
+                      const Pixel& p)
+        {
+            for (; n >= 0; --n)
+            {
+                if (SWAP)
+                {
+                    derived().writePixel(b, a, p);
+                }
+                else
+                {
+                    derived().writePixel(a, b, p);
+                }
+
+                a += s_major;
+                r += two_minor;
+                if (r >= two_major)
+                {
+                    r -= two_major;
+                    b += s_minor;
+                }
+            }
+        }
+
+        GfxDataReader gfx_reader_;
         const Font* font_{nullptr};
         unsigned int width_;
         unsigned int height_;
+        Rect clip_;
+        Rect clip_stack_[CLIP_STACK_DEPTH];
+        uint8_t clip_depth_;
+    };
+
+    /**
+     * Abstraction for raster displays.
+     * 
+     * Implementors must provide a method of setting a single pixel and a method to update the display.
+     * All other functions can be overridden for display specific optimizations.
+     *
+     * This is the runtime polymorphic variant of `StaticRasterDisplay`. Every primitive is dispatched through the vtable,
+     * so prefer deriving from `StaticRasterDisplay` directly where the concrete display type is known.
+     * 
+     * GfxDataReader - Because graphics data may be stored in a variety of ways on an embedded platform, provide a method
+     *                 for different targets to override how data is read (e.g. from flash)
+    */
+    template<class GfxDataReader = memory::DefaultMemoryReader>
+    class RasterDisplay : public StaticRasterDisplay<RasterDisplay<GfxDataReader>, GfxDataReader>
+    {
+        using Base = StaticRasterDisplay<RasterDisplay<GfxDataReader>, GfxDataReader>;
+
+    public:
+        RasterDisplay(unsigned int width, unsigned int height)
+            : Base{width, height}
+        {
+        }
+
+        ~RasterDisplay() = default;
+
+        /**
+         * Set a pixel in the display
+        */
+        virtual void drawPixel(unsigned int col, unsigned int row, const Color& c) = 0;
+
+        /**
+         * Update the display
+        */
+        virtual void update() = 0;
+
+        virtual void updateRegion(const Rect& area)
+        {
+            Base::updateRegion(area);
+        }
+
+        virtual void drawLine(int x0, int y0, int x1, int y1, const Color& c)
+        {
+            Base::drawLine(x0, y0, x1, y1, c);
+        }
+
+        virtual void drawVLine(int x0, int y0, int h, const Color& c)
+        {
+            Base::drawVLine(x0, y0, h, c);
+        }
+
+        virtual void drawHLine(int x0, int y0, int w, const Color& c)
+        {
+            Base::drawHLine(x0, y0, w, c);
+        }
+
+        virtual void drawRect(int x0, int y0, int w, int h, const Color& c)
+        {
+            Base::drawRect(x0, y0, w, h, c);
+        }
+
+        virtual void drawFillRect(int x0, int y0, int w, int h, const Color& c)
+        {
+            Base::drawFillRect(x0, y0, w, h, c);
+        }
+
+        virtual void drawXBitmap(const uint8_t* const bitmap, int x, int y, int w, int h, const Color& c)
+        {
+            Base::drawXBitmap(bitmap, x, y, w, h, c);
+        }
+
+        virtual void drawSprite(const uint8_t* const sprite, int x, int y, const Color& c)
+        {
+            Base::drawSprite(sprite, x, y, c);
+        }
+
+        virtual void drawScaledXBitmap(const uint8_t* const bitmap, int x, int y, int w, int h, uint8_t factor,
+                                       const Color& c)
+        {
+            Base::drawScaledXBitmap(bitmap, x, y, w, h, factor, c);
+        }
+
+        virtual void drawScaledChar(const char ch, int x, int y, uint8_t factor, const Color& c)
+        {
+            Base::drawScaledChar(ch, x, y, factor, c);
+        }
+
+        virtual void drawScaledString(const char* str, int x, int y, uint8_t factor, const Color& c)
+        {
+            Base::drawScaledString(str, x, y, factor, c);
+        }
+
+        virtual void drawChar(const char ch, int x, int y, const Color& c)
+        {
+            Base::drawChar(ch, x, y, c);
+        }
+
+        virtual void drawString(const char* str, int x, int y, const Color& c)
+        {
+            Base::drawString(str, x, y, c);
+        }
+
+        virtual void setFont(const Font* font)
+        {
+            Base::setFont(font);
+        }
+
+        virtual void drawCircle(int xc, int yc, int r, const Color& c)
+        {
+            Base::drawCircle(xc, yc, r, c);
+        }
+
+        virtual void drawFillCircle(int xc, int yc, int r, const Color& c)
+        {
+            Base::drawFillCircle(xc, yc, r, c);
+        }
+
+        virtual void drawArc(int xc, int yc, int r, uint8_t quadrants, const Color& c)
+        {
+            Base::drawArc(xc, yc, r, quadrants, c);
+        }
+
+        virtual void drawEllipse(int xc, int yc, int rx, int ry, const Color& c)
+        {
+            Base::drawEllipse(xc, yc, rx, ry, c);
+        }
+
+        virtual void drawFillEllipse(int xc, int yc, int rx, int ry, const Color& c)
+        {
+            Base::drawFillEllipse(xc, yc, rx, ry, c);
+        }
+
+        virtual void drawRoundRect(int x0, int y0, int w, int h, int r, const Color& c)
+        {
+            Base::drawRoundRect(x0, y0, w, h, r, c);
+        }
+
+        virtual void drawFillRoundRect(int x0, int y0, int w, int h, int r, const Color& c)
+        {
+            Base::drawFillRoundRect(x0, y0, w, h, r, c);
+        }
+
+        virtual void setClip(const Rect& r)
+        {
+            Base::setClip(r);
+        }
+
+        virtual void resetClip()
+        {
+            Base::resetClip();
+        }
+
+        virtual bool pushClip(const Rect& r)
+        {
+            return Base::pushClip(r);
+        }
+
+        virtual void popClip()
+        {
+            Base::popClip();
+        }
     };
 }
 }
@@ -0,0 +1,239 @@
+//
+// display_list.hpp
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+
+#ifndef FTL_GFX_DISPLAY_LIST_HPP
+#define FTL_GFX_DISPLAY_LIST_HPP
+
+#include <stdint.h>
+
+#include <ftl/gfx/color.hpp>
+#include <ftl/gfx/font.hpp>
+#include <ftl/gfx/rect.hpp>
+
+namespace ftl
+{
+namespace gfx
+{
+
+/**
+ * Recorded drawing operations
+*/
+enum class DisplayOp : uint8_t
+{
+    Pixel,
+    Line,
+    HLine,
+    VLine,
+    Rect,
+    FillRect,
+    XBitmap,
+    Sprite,
+    Char,
+    String,
+    Circle,
+    FillCircle,
+    Arc,
+    Ellipse,
+    FillEllipse,
+    RoundRect,
+    FillRoundRect,
+    ScaledXBitmap,
+    ScaledChar,
+    ScaledString,
+    SetClip,
+    ResetClip,
+    PushClip,
+    PopClip,
+    SetFont,
+};
+
+/**
+ * A single recorded draw call
+*/
+struct DisplayCommand
+{
+    DisplayOp op;
+    uint8_t color;
+    int16_t a;
+    int16_t b;
+    int16_t c;
+    int16_t d;
+    // Radius of rounded rectangles, quadrants of arcs, scale factor of scaled bitmaps and text
+    uint8_t e;
+    const void* ptr;
+};
+
+/**
+ * Fixed capacity list of draw calls that can be replayed against any display.
+ *
+ * Used to render a frame in several passes (e.g. once per page) without storing the whole frame. Pointers passed to
+ * bitmap, string and font commands are stored, not copied, and must stay valid until the list is replayed.
+ *
+ * \tparam N Maximum number of commands
+*/
+template<unsigned int N>
+class DisplayList
+{
+public:
+    static constexpr unsigned int CAPACITY = N;
+
+    DisplayList()
+        : size_{0}
+        , overflow_{false}
+    {
+    }
+
+    /**
+     * Record a command. Returns false and sets the overflow flag if the list is full
+    */
+    bool record(DisplayOp op, const Color& color, int a, int b, int c = 0, int d = 0, const void* ptr = nullptr,
+                uint8_t e = 0)
+    {
+        if (size_ >= N)
+        {
+            overflow_ = true;
+            return false;
+        }
+
+        auto& cmd = commands_[size_++];
+        cmd.op = op;
+        cmd.color = color.monochrome();
+        cmd.a = a;
+        cmd.b = b;
+        cmd.c = c;
+        cmd.d = d;
+        cmd.e = e;
+        cmd.ptr = ptr;
+
+        return true;
+    }
+
+    /**
+     * Replay every command, in order, against the target display
+    */
+    template<class Target>
+    void replay(Target& target) const
+    {
+        for (auto i = 0u; i < size_; ++i)
+        {
+            const auto& cmd = commands_[i];
+            const Color color = cmd.color ? Color::white() : Color::black();
+
+            switch (cmd.op)
+            {
+            case DisplayOp::Pixel:
+                target.drawPixel(cmd.a, cmd.b, color);
+                break;
+            case DisplayOp::Line:
+                target.drawLine(cmd.a, cmd.b, cmd.c, cmd.d, color);
+                break;
+            case DisplayOp::HLine:
+                target.drawHLine(cmd.a, cmd.b, cmd.c, color);
+                break;
+            case DisplayOp::VLine:
+                target.drawVLine(cmd.a, cmd.b, cmd.c, color);
+                break;
+            case DisplayOp::Rect:
+                target.drawRect(cmd.a, cmd.b, cmd.c, cmd.d, color);
+                break;
+            case DisplayOp::FillRect:
+                target.drawFillRect(cmd.a, cmd.b, cmd.c, cmd.d, color);
+                break;
+            case DisplayOp::XBitmap:
+                target.drawXBitmap(static_cast<const uint8_t*>(cmd.ptr), cmd.a, cmd.b, cmd.c, cmd.d, color);
+                break;
+            case DisplayOp::Sprite:
+                target.drawSprite(static_cast<const uint8_t*>(cmd.ptr), cmd.a, cmd.b, color);
+                break;
+            case DisplayOp::Char:
+                target.drawChar(static_cast<char>(cmd.c), cmd.a, cmd.b, color);
+                break;
+            case DisplayOp::String:
+                target.drawString(static_cast<const char*>(cmd.ptr), cmd.a, cmd.b, color);
+                break;
+            case DisplayOp::Circle:
+                target.drawCircle(cmd.a, cmd.b, cmd.c, color);
+                break;
+            case DisplayOp::FillCircle:
+                target.drawFillCircle(cmd.a, cmd.b, cmd.c, color);
+                break;
+            case DisplayOp::Arc:
+                target.drawArc(cmd.a, cmd.b, cmd.c, cmd.e, color);
+                break;
+            case DisplayOp::Ellipse:
+                target.drawEllipse(cmd.a, cmd.b, cmd.c, cmd.d, color);
+                break;
+            case DisplayOp::FillEllipse:
+                target.drawFillEllipse(cmd.a, cmd.b, cmd.c, cmd.d, color);
+                break;
+            case DisplayOp::RoundRect:
+                target.drawRoundRect(cmd.a, cmd.b, cmd.c, cmd.d, cmd.e, color);
+                break;
+            case DisplayOp::FillRoundRect:
+                target.drawFillRoundRect(cmd.a, cmd.b, cmd.c, cmd.d, cmd.e, color);
+                break;
+            case DisplayOp::ScaledXBitmap:
+                target.drawScaledXBitmap(static_cast<const uint8_t*>(cmd.ptr), cmd.a, cmd.b, cmd.c, cmd.d, cmd.e,
+                                         color);
+                break;
+            case DisplayOp::ScaledChar:
+                target.drawScaledChar(static_cast<char>(cmd.c), cmd.a, cmd.b, cmd.e, color);
+                break;
+            case DisplayOp::ScaledString:
+                target.drawScaledString(static_cast<const char*>(cmd.ptr), cmd.a, cmd.b, cmd.e, color);
+                break;
+            case DisplayOp::SetClip:
+                target.setClip(Rect{cmd.a, cmd.b, cmd.c, cmd.d});
+                break;
+            case DisplayOp::ResetClip:
+                target.resetClip();
+                break;
+            case DisplayOp::PushClip:
+                target.pushClip(Rect{cmd.a, cmd.b, cmd.c, cmd.d});
+                break;
+            case DisplayOp::PopClip:
+                target.popClip();
+                break;
+            case DisplayOp::SetFont:
+                target.setFont(static_cast<const Font*>(cmd.ptr));
+                break;
+            }
+        }
+    }
+
+    /**
+     * Remove all commands and reset the overflow flag
+    */
+    void clear()
+    {
+        size_ = 0;
+        overflow_ = false;
+    }
+
+    unsigned int size() const
+    {
+        return size_;
+    }
+
+    /**
+     * @return true if commands were dropped because the list was full
+    */
+    bool overflowed() const
+    {
+        return overflow_;
+    }
+
+private:
+    DisplayCommand commands_[N];
+    unsigned int size_;
+    bool overflow_;
+};
+
+}
+}
+
+#endif // FTL_GFX_DISPLAY_LIST_HPP
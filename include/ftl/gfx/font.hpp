@@ -15,21 +15,109 @@ namespace ftl
 {
 namespace gfx
 {
+/**
+ * Glyph storage layouts
+ *
+ * Rows   - One byte per glyph row, bit N is column N (LSB is the left most pixel)
+ * Pages  - One byte per glyph column, bit N is row N (LSB is the top pixel). Matches the page layout of SSD1306 style
+ *          framebuffers so a glyph can be copied a byte per column
+ * Packed - Proportional font with per glyph widths and bit packed columns, see below
+ *
+ * Rows and Pages fonts are 8x8 tiles indexed by character code, 128 or 256 glyphs.
+ *
+ * Packed fonts only store the glyphs they use, and only the columns of each glyph. The data is generated by
+ * `scripts/fontgen.py`:
+ *
+ *   [0]      spacing, blank columns drawn after each glyph
+ *   [1]      N, number of character ranges
+ *   [2, 3]   offset of the bitmap from the start of the data (little endian)
+ *   [4...]   N ranges of (first character, last character, index of the first glyph)
+ *   ...      glyph table, (width, bit offset low byte, bit offset high byte) per glyph
+ *   ...      bitmap
+ *
+ * A glyph is `width` columns of `height` bits, LSB first with the top pixel first. Glyphs are not byte aligned, each
+ * starts at its bit offset in the bitmap.
+*/
+enum class FontLayout
+{
+    Rows,
+    Pages,
+    Packed,
+};
+
+/**
+ * Location of a glyph in a packed font
+*/
+struct Glyph
+{
+    // Columns stored in the bitmap
+    uint8_t width;
+    // Columns the cursor advances by, including the spacing
+    uint8_t advance;
+    // Offset of the first bit of the glyph in the bitmap
+    uint16_t bit_offset;
+};
+
+/**
+ * Read the bits of a packed glyph in order, at most a byte at a time
+*/
+template<class Cursor>
+class GlyphBits
+{
+public:
+    GlyphBits(const Cursor& cursor, uint8_t skip)
+        : cursor_{cursor}
+        , bits_{0}
+        , available_{0}
+    {
+        if (skip) next(skip);
+    }
+
+    /**
+     * Read the next n bits (1 to 8). The first bit is the LSB of the result
+    */
+    uint8_t next(uint8_t n)
+    {
+        uint16_t bits = bits_;
+        uint8_t available = available_;
+
+        if (available < n)
+        {
+            bits |= static_cast<uint16_t>(cursor_.next()) << available;
+            available += 8;
+        }
+
+        bits_ = static_cast<uint8_t>(bits >> n);
+        available_ = available - n;
+
+        return static_cast<uint8_t>(bits & ((1u << n) - 1));
+    }
+
+private:
+    Cursor cursor_;
+    // Bits read from the cursor and not returned yet, LSB first
+    uint8_t bits_;
+    uint8_t available_;
+};
+
 /**
  * Handle Font data
- * 
- * Currently this assumes 8x8 tiles
+ *
+ * Rows and Pages fonts are 8x8 tiles. Packed fonts are proportional, `width()` is the widest glyph
 */
 class Font
 {
 public:
-    Font(const uint8_t* data)
+    Font(const uint8_t* data, FontLayout layout = FontLayout::Rows, uint8_t width = 8, uint8_t height = 8)
         : font_data_{data}
+        , layout_{layout}
+        , width_{width}
+        , height_{height}
     {
     }
 
     /**
-     * Return if the pixel at the specified location in the glyph
+     * Return if the pixel at the specified location in the glyph. Rows and Pages layouts only
     */
     template<typename DataReader>
     bool at(char c, unsigned int x, unsigned int y, const DataReader& reader) const
@@ -37,24 +125,187 @@ public:
         if (!font_data_) return false;
 
         const auto offset = (unsigned int)c * 8;
+
+        if (layout_ == FontLayout::Pages)
+        {
+            return !!(reader(font_data_, offset + x) & (1 << y));
+        }
+
         const uint8_t data = reader(font_data_, offset + y);
 
         return !!(data & (1 << x));
     }
 
+    /**
+     * Offset of the first byte of a glyph in the font data. Rows and Pages layouts only
+    */
+    unsigned int offset(char c) const
+    {
+        return (unsigned int)c * 8;
+    }
+
+    /**
+     * Look up a glyph of a packed font. Returns false if the font has no glyph for the character
+    */
+    template<typename DataReader>
+    bool glyph(char c, Glyph& glyph, const DataReader& reader) const
+    {
+        if (!font_data_ || layout_ != FontLayout::Packed) return false;
+
+        const auto code = static_cast<uint8_t>(c);
+
+        auto cursor = reader.cursor(font_data_);
+        const uint8_t spacing = cursor.next();
+        const uint8_t num_ranges = cursor.next();
+        cursor.skip(2);
+
+        // Ranges are few, a linear scan finds the glyph index with a subtraction
+        for (auto i = 0u; i < num_ranges; ++i)
+        {
+            const uint8_t first = cursor.next();
+            const uint8_t last = cursor.next();
+            const uint8_t index = cursor.next();
+
+            if (code >= first && code <= last)
+            {
+                const auto entry = HEADER_SIZE + num_ranges * RANGE_SIZE + (index + code - first) * GLYPH_SIZE;
+                auto glyph_cursor = reader.cursor(font_data_, entry);
+
+                glyph.width = glyph_cursor.next();
+                glyph.advance = glyph.width + spacing;
+                glyph.bit_offset = glyph_cursor.next();
+                glyph.bit_offset |= static_cast<uint16_t>(glyph_cursor.next()) << 8;
+
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * Bit reader positioned at the first column of a packed glyph
+    */
+    template<typename DataReader>
+    GlyphBits<typename DataReader::Cursor> bits(const Glyph& glyph, const DataReader& reader) const
+    {
+        const uint16_t bitmap = reader(font_data_, 2) | (static_cast<uint16_t>(reader(font_data_, 3)) << 8);
+
+        return GlyphBits<typename DataReader::Cursor>{reader.cursor(font_data_, bitmap + (glyph.bit_offset >> 3)),
+                                                      static_cast<uint8_t>(glyph.bit_offset & 0x07)};
+    }
+
+    /**
+     * Number of columns the cursor moves by after drawing the character. 0 for characters a packed font does not have
+    */
+    template<typename DataReader>
+    unsigned int advance(char c, const DataReader& reader) const
+    {
+        if (layout_ != FontLayout::Packed) return width_;
+
+        Glyph g;
+        return glyph(c, g, reader) ? g.advance : 0;
+    }
+
+    /**
+     * Width of a string in pixels, up to the first line break
+    */
+    template<typename DataReader>
+    unsigned int textWidth(const char* str, const DataReader& reader) const
+    {
+        unsigned int w = 0;
+        while (*str && *str != '\n' && *str != '\r')
+        {
+            w += advance(*str++, reader);
+        }
+
+        return w;
+    }
+
     unsigned int width() const
     {
-        return 8;
+        return width_;
     }
 
     unsigned int height() const
     {
-        return 8;
+        return height_;
+    }
+
+    FontLayout layout() const
+    {
+        return layout_;
+    }
+
+    const uint8_t* data() const
+    {
+        return font_data_;
     }
 
 private:
+    // Sizes of the parts of the packed font data
+    static constexpr uint8_t HEADER_SIZE = 4;
+    static constexpr uint8_t RANGE_SIZE = 3;
+    static constexpr uint8_t GLYPH_SIZE = 3;
+
     const uint8_t* font_data_{nullptr};
+    FontLayout layout_;
+    uint8_t width_;
+    uint8_t height_;
+};
+
+/**
+ * Storage for font data generated at compile time
+*/
+template<unsigned int N>
+struct FontData
+{
+    uint8_t data[N];
 };
+
+/**
+ * Copy font data at compile time, e.g. to place a font defined as a plain array in flash
+ *
+ * constexpr FontData<sizeof(DATA)> FLASH_DATA FTL_FLASH = toFontData(DATA);
+*/
+template<unsigned int N>
+constexpr FontData<N> toFontData(const uint8_t (&data)[N])
+{
+    FontData<N> copy{};
+
+    for (auto i = 0u; i < N; ++i)
+    {
+        copy.data[i] = data[i];
+    }
+
+    return copy;
+}
+
+/**
+ * Convert 8x8 glyphs stored in the `Rows` layout to the `Pages` layout at compile time
+ *
+ * constexpr FontData<sizeof(ROW_DATA)> PAGE_DATA = toPageLayout(ROW_DATA);
+*/
+template<unsigned int N>
+constexpr FontData<N> toPageLayout(const uint8_t (&rows)[N])
+{
+    FontData<N> pages{};
+
+    for (auto glyph = 0u; glyph < N / 8; ++glyph)
+    {
+        for (auto x = 0u; x < 8; ++x)
+        {
+            uint8_t column = 0;
+            for (auto y = 0u; y < 8; ++y)
+            {
+                column |= ((rows[glyph * 8 + y] >> x) & 0x01) << y;
+            }
+            pages.data[glyph * 8 + x] = column;
+        }
+    }
+
+    return pages;
+}
 }
 }
 
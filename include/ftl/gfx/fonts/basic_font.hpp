@@ -9,6 +9,7 @@
 #define FTL_GFX_FONTS_BASIC_FONT_HPP
 
 #include <ftl/gfx/font.hpp>
+#include <ftl/memory/flash.hpp>
 
 #include <stdint.h>
 
@@ -21,7 +22,7 @@ namespace fonts
 
 // https://github.com/dhepper/font8x8/blob/master/font8x8_basic.h
 
-const uint8_t BASIC_FONT_DATA[] = {
+constexpr uint8_t BASIC_FONT_DATA[] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0000 (nul)
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0001
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // U+0002
@@ -154,6 +155,12 @@ const uint8_t BASIC_FONT_DATA[] = {
 
 const Font BASIC_FONT{BASIC_FONT_DATA};
 
+// Basic font converted to the page layout for page framebuffer displays. Stored in flash, so displays and consoles
+// using BASIC_PAGE_FONT must read graphics data with `memory::FlashReader`
+constexpr FontData<sizeof(BASIC_FONT_DATA)> BASIC_FONT_PAGE_DATA FTL_FLASH = toPageLayout(BASIC_FONT_DATA);
+
+const Font BASIC_PAGE_FONT{BASIC_FONT_PAGE_DATA.data, FontLayout::Pages};
+
 }
 }
 }
@@ -0,0 +1,112 @@
+//
+// basic_prop_font.hpp
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+
+#ifndef FTL_GFX_FONTS_BASIC_PROP_FONT_HPP
+#define FTL_GFX_FONTS_BASIC_PROP_FONT_HPP
+
+#include <ftl/gfx/font.hpp>
+#include <ftl/memory/flash.hpp>
+
+#include <stdint.h>
+
+namespace ftl
+{
+namespace gfx
+{
+namespace fonts
+{
+
+// Proportional version of the basic font, printable ASCII (0x20 - 0x7E)
+// python3 scripts/fontgen.py include/ftl/gfx/fonts/basic_font.hpp
+constexpr uint8_t BASIC_PROP_FONT_DATA[] = {
+    0x01, 0x01, 0x24, 0x01, 0x20, 0x7e, 0x00, 0x02, 0x00, 0x00, 0x04, 0x10,
+    0x00, 0x05, 0x30, 0x00, 0x07, 0x58, 0x00, 0x06, 0x90, 0x00, 0x07, 0xc0,
+    0x00, 0x07, 0xf8, 0x00, 0x03, 0x30, 0x01, 0x04, 0x48, 0x01, 0x04, 0x68,
+    0x01, 0x08, 0x88, 0x01, 0x06, 0xc8, 0x01, 0x03, 0xf8, 0x01, 0x06, 0x10,
+    0x02, 0x02, 0x40, 0x02, 0x07, 0x50, 0x02, 0x07, 0x88, 0x02, 0x06, 0xc0,
+    0x02, 0x06, 0xf0, 0x02, 0x06, 0x20, 0x03, 0x07, 0x50, 0x03, 0x06, 0x88,
+    0x03, 0x06, 0xb8, 0x03, 0x06, 0xe8, 0x03, 0x06, 0x18, 0x04, 0x06, 0x48,
+    0x04, 0x02, 0x78, 0x04, 0x03, 0x88, 0x04, 0x05, 0xa0, 0x04, 0x06, 0xc8,
+    0x04, 0x05, 0xf8, 0x04, 0x06, 0x20, 0x05, 0x07, 0x50, 0x05, 0x06, 0x88,
+    0x05, 0x07, 0xb8, 0x05, 0x07, 0xf0, 0x05, 0x07, 0x28, 0x06, 0x07, 0x60,
+    0x06, 0x07, 0x98, 0x06, 0x07, 0xd0, 0x06, 0x06, 0x08, 0x07, 0x04, 0x38,
+    0x07, 0x07, 0x58, 0x07, 0x07, 0x90, 0x07, 0x07, 0xc8, 0x07, 0x07, 0x00,
+    0x08, 0x07, 0x38, 0x08, 0x07, 0x70, 0x08, 0x07, 0xa8, 0x08, 0x06, 0xe0,
+    0x08, 0x07, 0x10, 0x09, 0x06, 0x48, 0x09, 0x06, 0x78, 0x09, 0x06, 0xa8,
+    0x09, 0x06, 0xd8, 0x09, 0x07, 0x08, 0x0a, 0x07, 0x40, 0x0a, 0x06, 0x78,
+    0x0a, 0x07, 0xa8, 0x0a, 0x04, 0xe0, 0x0a, 0x07, 0x00, 0x0b, 0x04, 0x38,
+    0x0b, 0x07, 0x58, 0x0b, 0x08, 0x90, 0x0b, 0x03, 0xd0, 0x0b, 0x07, 0xe8,
+    0x0b, 0x07, 0x20, 0x0c, 0x06, 0x58, 0x0c, 0x07, 0x88, 0x0c, 0x06, 0xc0,
+    0x0c, 0x06, 0xf0, 0x0c, 0x07, 0x20, 0x0d, 0x07, 0x58, 0x0d, 0x04, 0x90,
+    0x0d, 0x06, 0xb0, 0x0d, 0x07, 0xe0, 0x0d, 0x04, 0x18, 0x0e, 0x07, 0x38,
+    0x0e, 0x06, 0x70, 0x0e, 0x06, 0xa0, 0x0e, 0x07, 0xd0, 0x0e, 0x07, 0x08,
+    0x0f, 0x07, 0x40, 0x0f, 0x06, 0x78, 0x0f, 0x05, 0xa8, 0x0f, 0x07, 0xd0,
+    0x0f, 0x06, 0x08, 0x10, 0x07, 0x38, 0x10, 0x07, 0x70, 0x10, 0x06, 0xa8,
+    0x10, 0x06, 0xd8, 0x10, 0x06, 0x08, 0x11, 0x02, 0x38, 0x11, 0x06, 0x48,
+    0x11, 0x07, 0x78, 0x11, 0x00, 0x00, 0x06, 0x5f, 0x5f, 0x06, 0x03, 0x03,
+    0x00, 0x03, 0x03, 0x14, 0x7f, 0x7f, 0x14, 0x7f, 0x7f, 0x14, 0x24, 0x2e,
+    0x6b, 0x6b, 0x3a, 0x12, 0x46, 0x66, 0x30, 0x18, 0x0c, 0x66, 0x62, 0x30,
+    0x7a, 0x4f, 0x5d, 0x37, 0x7a, 0x48, 0x04, 0x07, 0x03, 0x1c, 0x3e, 0x63,
+    0x41, 0x41, 0x63, 0x3e, 0x1c, 0x08, 0x2a, 0x3e, 0x1c, 0x1c, 0x3e, 0x2a,
+    0x08, 0x08, 0x08, 0x3e, 0x3e, 0x08, 0x08, 0x80, 0xe0, 0x60, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x60, 0x60, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x03,
+    0x01, 0x3e, 0x7f, 0x71, 0x59, 0x4d, 0x7f, 0x3e, 0x40, 0x42, 0x7f, 0x7f,
+    0x40, 0x40, 0x62, 0x73, 0x59, 0x49, 0x6f, 0x66, 0x22, 0x63, 0x49, 0x49,
+    0x7f, 0x36, 0x18, 0x1c, 0x16, 0x53, 0x7f, 0x7f, 0x50, 0x27, 0x67, 0x45,
+    0x45, 0x7d, 0x39, 0x3c, 0x7e, 0x4b, 0x49, 0x79, 0x30, 0x03, 0x03, 0x71,
+    0x79, 0x0f, 0x07, 0x36, 0x7f, 0x49, 0x49, 0x7f, 0x36, 0x06, 0x4f, 0x49,
+    0x69, 0x3f, 0x1e, 0x66, 0x66, 0x80, 0xe6, 0x66, 0x08, 0x1c, 0x36, 0x63,
+    0x41, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x41, 0x63, 0x36, 0x1c, 0x08,
+    0x02, 0x03, 0x51, 0x59, 0x0f, 0x06, 0x3e, 0x7f, 0x41, 0x5d, 0x5d, 0x1f,
+    0x1e, 0x7c, 0x7e, 0x13, 0x13, 0x7e, 0x7c, 0x41, 0x7f, 0x7f, 0x49, 0x49,
+    0x7f, 0x36, 0x1c, 0x3e, 0x63, 0x41, 0x41, 0x63, 0x22, 0x41, 0x7f, 0x7f,
+    0x41, 0x63, 0x3e, 0x1c, 0x41, 0x7f, 0x7f, 0x49, 0x5d, 0x41, 0x63, 0x41,
+    0x7f, 0x7f, 0x49, 0x1d, 0x01, 0x03, 0x1c, 0x3e, 0x63, 0x41, 0x51, 0x73,
+    0x72, 0x7f, 0x7f, 0x08, 0x08, 0x7f, 0x7f, 0x41, 0x7f, 0x7f, 0x41, 0x30,
+    0x70, 0x40, 0x41, 0x7f, 0x3f, 0x01, 0x41, 0x7f, 0x7f, 0x08, 0x1c, 0x77,
+    0x63, 0x41, 0x7f, 0x7f, 0x41, 0x40, 0x60, 0x70, 0x7f, 0x7f, 0x0e, 0x1c,
+    0x0e, 0x7f, 0x7f, 0x7f, 0x7f, 0x06, 0x0c, 0x18, 0x7f, 0x7f, 0x1c, 0x3e,
+    0x63, 0x41, 0x63, 0x3e, 0x1c, 0x41, 0x7f, 0x7f, 0x49, 0x09, 0x0f, 0x06,
+    0x1e, 0x3f, 0x21, 0x71, 0x7f, 0x5e, 0x41, 0x7f, 0x7f, 0x09, 0x19, 0x7f,
+    0x66, 0x26, 0x6f, 0x4d, 0x59, 0x73, 0x32, 0x03, 0x41, 0x7f, 0x7f, 0x41,
+    0x03, 0x7f, 0x7f, 0x40, 0x40, 0x7f, 0x7f, 0x1f, 0x3f, 0x60, 0x60, 0x3f,
+    0x1f, 0x7f, 0x7f, 0x30, 0x18, 0x30, 0x7f, 0x7f, 0x43, 0x67, 0x3c, 0x18,
+    0x3c, 0x67, 0x43, 0x07, 0x4f, 0x78, 0x78, 0x4f, 0x07, 0x47, 0x63, 0x71,
+    0x59, 0x4d, 0x67, 0x73, 0x7f, 0x7f, 0x41, 0x41, 0x01, 0x03, 0x06, 0x0c,
+    0x18, 0x30, 0x60, 0x41, 0x41, 0x7f, 0x7f, 0x08, 0x0c, 0x06, 0x03, 0x06,
+    0x0c, 0x08, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x03, 0x07,
+    0x04, 0x20, 0x74, 0x54, 0x54, 0x3c, 0x78, 0x40, 0x41, 0x7f, 0x3f, 0x48,
+    0x48, 0x78, 0x30, 0x38, 0x7c, 0x44, 0x44, 0x6c, 0x28, 0x30, 0x78, 0x48,
+    0x49, 0x3f, 0x7f, 0x40, 0x38, 0x7c, 0x54, 0x54, 0x5c, 0x18, 0x48, 0x7e,
+    0x7f, 0x49, 0x03, 0x02, 0x98, 0xbc, 0xa4, 0xa4, 0xf8, 0x7c, 0x04, 0x41,
+    0x7f, 0x7f, 0x08, 0x04, 0x7c, 0x78, 0x44, 0x7d, 0x7d, 0x40, 0x60, 0xe0,
+    0x80, 0x80, 0xfd, 0x7d, 0x41, 0x7f, 0x7f, 0x10, 0x38, 0x6c, 0x44, 0x41,
+    0x7f, 0x7f, 0x40, 0x7c, 0x7c, 0x18, 0x38, 0x1c, 0x7c, 0x78, 0x7c, 0x7c,
+    0x04, 0x04, 0x7c, 0x78, 0x38, 0x7c, 0x44, 0x44, 0x7c, 0x38, 0x84, 0xfc,
+    0xf8, 0xa4, 0x24, 0x3c, 0x18, 0x18, 0x3c, 0x24, 0xa4, 0xf8, 0xfc, 0x84,
+    0x44, 0x7c, 0x78, 0x4c, 0x04, 0x1c, 0x18, 0x48, 0x5c, 0x54, 0x54, 0x74,
+    0x24, 0x04, 0x3e, 0x7f, 0x44, 0x24, 0x3c, 0x7c, 0x40, 0x40, 0x3c, 0x7c,
+    0x40, 0x1c, 0x3c, 0x60, 0x60, 0x3c, 0x1c, 0x3c, 0x7c, 0x70, 0x38, 0x70,
+    0x7c, 0x3c, 0x44, 0x6c, 0x38, 0x10, 0x38, 0x6c, 0x44, 0x9c, 0xbc, 0xa0,
+    0xa0, 0xfc, 0x7c, 0x4c, 0x64, 0x74, 0x5c, 0x4c, 0x64, 0x08, 0x08, 0x3e,
+    0x77, 0x41, 0x41, 0x77, 0x77, 0x41, 0x41, 0x77, 0x3e, 0x08, 0x08, 0x02,
+    0x03, 0x01, 0x03, 0x02, 0x03, 0x01,
+};
+
+const Font BASIC_PROP_FONT{BASIC_PROP_FONT_DATA, FontLayout::Packed, 8, 8};
+
+// Copy of the proportional font stored in flash. Must be read with `memory::FlashReader`
+constexpr FontData<sizeof(BASIC_PROP_FONT_DATA)> BASIC_PROP_FONT_FLASH_DATA FTL_FLASH =
+    toFontData(BASIC_PROP_FONT_DATA);
+
+const Font BASIC_PROP_FLASH_FONT{BASIC_PROP_FONT_FLASH_DATA.data, FontLayout::Packed, 8, 8};
+
+}
+}
+}
+
+#endif // FTL_GFX_FONTS_BASIC_PROP_FONT_HPP
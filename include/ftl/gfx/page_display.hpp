@@ -0,0 +1,384 @@
+//
+// page_display.hpp
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+
+#ifndef FTL_GFX_PAGE_DISPLAY_HPP
+#define FTL_GFX_PAGE_DISPLAY_HPP
+
+#include <stdint.h>
+
+#include <ftl/gfx/display.hpp>
+#include <ftl/gfx/color.hpp>
+#include <ftl/gfx/font.hpp>
+#include <ftl/gfx/page_framebuffer.hpp>
+#include <ftl/gfx/pixel_format.hpp>
+#include <ftl/gfx/scale.hpp>
+#include <ftl/gfx/sprite.hpp>
+
+namespace ftl
+{
+namespace gfx
+{
+
+/**
+ * Raster display backed by a monochrome page framebuffer.
+ *
+ * Provides byte-wise span fills and column glyph copies on top of `StaticRasterDisplay`. Pixels are `Mono1`, so the
+ * generic primitives write a 0/1 value straight into the framebuffer. Derived displays provide `update()`.
+ *
+ * Derived       - The concrete display type
+ * FrameBufferT  - `PageFrameBuffer` or `PageWindow`
+ * GfxDataReader - Method of reading graphics data (e.g. from flash)
+*/
+template<class Derived, class FrameBufferT, class GfxDataReader>
+class PageRasterDisplay : public StaticRasterDisplay<Derived, GfxDataReader>
+{
+    using Base = StaticRasterDisplay<Derived, GfxDataReader>;
+
+public:
+    using PixelFormat = Mono1;
+
+    template<typename... Args>
+    PageRasterDisplay(unsigned int width, unsigned int height, Args&... args)
+        : Base{width, height}
+        , framebuffer_{args...}
+    {
+    }
+
+    /**
+     * Set a single pixel. Pixels outside the clip region are ignored
+    */
+    void drawPixel(unsigned int col, unsigned int row, const Color& c)
+    {
+        if (!this->clip().contains(col, row)) return;
+        framebuffer_.setPixel(col, row, Mono1::fromColor(c));
+    }
+
+    /**
+     * Write a native pixel. The position is not checked
+    */
+    void writePixel(int x, int y, Mono1::Pixel value)
+    {
+        framebuffer_.setPixel(x, y, value);
+    }
+
+    /**
+     * Draw a vertical line. Each page the line crosses is a single masked write
+    */
+    void drawVLine(int x0, int y0, int h, const Color& c)
+    {
+        int x1 = x0;
+        int y1 = y0 + h;
+        if (!this->clipRect(x0, y0, x1, y1)) return;
+
+        framebuffer_.fillVSpan(x0, y0, y1, Mono1::fromColor(c));
+    }
+
+    /**
+     * Draw a horizontal line
+    */
+    void drawHLine(int x0, int y0, int w, const Color& c)
+    {
+        int x1 = x0 + w;
+        int y1 = y0;
+        if (!this->clipRect(x0, y0, x1, y1)) return;
+
+        framebuffer_.fillHSpan(x0, x1, y0, Mono1::fromColor(c));
+    }
+
+    /**
+     * Draw fill rectangle. Whole pages are filled with a memset, partial pages with an edge mask
+    */
+    void drawFillRect(int x0, int y0, int w, int h, const Color& c)
+    {
+        if (w < 0 || h < 0) return;
+
+        int x1 = x0 + w;
+        int y1 = y0 + h;
+        if (!this->clipRect(x0, y0, x1, y1)) return;
+
+        framebuffer_.fillRect(x0, y0, x1, y1, Mono1::fromColor(c));
+    }
+
+    /**
+     * Draw a single character from the set font.
+     *
+     * Fonts in the `Pages` layout are copied a column byte at a time. Page aligned characters are 8 byte stores,
+     * otherwise each column is merged into the two pages it crosses. `Packed` fonts are unpacked 8 rows at a time and
+     * written the same way.
+    */
+    void drawChar(const char c, int x, int y, const Color& color)
+    {
+        const auto* font = this->font();
+        if (font && font->layout() == FontLayout::Packed)
+        {
+            drawPackedChar(*font, c, x, y, color);
+            return;
+        }
+
+        if (!font || font->layout() != FontLayout::Pages)
+        {
+            Base::drawChar(c, x, y, color);
+            return;
+        }
+
+        const uint8_t rows = clipRows(y);
+        if (!rows) return;
+
+        const auto& clip = this->clip();
+        const uint8_t fg = Mono1::fromColor(color) ? 0xFF : 0x00;
+        auto cursor = this->reader().cursor(font->data(), font->offset(c));
+
+        for (auto i = 0u; i < font->width(); ++i)
+        {
+            const int col = x + i;
+            const uint8_t bits = cursor.next() & fg;
+
+            if (col < clip.x0 || col > clip.x1) continue;
+
+            if (rows == 0xFF)
+            {
+                framebuffer_.writeColumn(col, y, bits);
+            }
+            else
+            {
+                // Partially clipped, only write the visible rows
+                framebuffer_.writeColumnBits(col, y, rows & bits, 1);
+                framebuffer_.writeColumnBits(col, y, rows & ~bits, 0);
+            }
+        }
+    }
+
+    /**
+     * Draw a run length encoded sprite. Each column byte is merged into the framebuffer with a masked write and
+     * transparent runs are skipped without touching the framebuffer
+    */
+    void drawSprite(const uint8_t* const sprite, int x, int y, const Color& c)
+    {
+        const auto& clip = this->clip();
+        const Rect bounds{x, y, x + sprite::width(sprite, this->reader()) - 1,
+                          y + sprite::height(sprite, this->reader()) - 1};
+        if (clip.intersect(bounds).empty()) return;
+
+        const uint8_t value = Mono1::fromColor(c);
+
+        sprite::decode(sprite, this->reader(), [&](uint8_t col, uint8_t page_row, uint8_t bits)
+        {
+            const int px = x + col;
+            const int py = y + page_row * 8;
+            if (px < clip.x0 || px > clip.x1) return;
+
+            framebuffer_.writeColumnBits(px, py, bits & clipRows(py), value);
+        });
+    }
+
+    /**
+     * Draw a character scaled by an integer factor. Each glyph column byte is expanded with `scale::expand()` and
+     * written as whole page bytes, so page aligned characters cost factor * factor byte stores per glyph column
+    */
+    void drawScaledChar(const char c, int x, int y, uint8_t factor, const Color& color)
+    {
+        const auto* font = this->font();
+        if (!font || factor == 0 || factor > scale::MAX_FACTOR) return;
+
+        const Rect bounds{x, y, x + static_cast<int>(font->width()) * factor - 1,
+                          y + static_cast<int>(font->height()) * factor - 1};
+        if (this->clip().intersect(bounds).empty()) return;
+
+        const uint8_t fg = Mono1::fromColor(color) ? 0xFF : 0x00;
+
+        this->decodeGlyph(c, [&](int i, int row, uint8_t bits, uint8_t n)
+        {
+            writeScaledColumn(x + i * factor, y + row * factor, bits & fg, 0xFF >> (8 - n), factor, true, 0);
+        });
+    }
+
+    /**
+     * Draw a bitmap in XBITMAP format scaled by an integer factor. Each 8 row band of the bitmap is gathered into
+     * column bytes, which are expanded and merged into the framebuffer like `drawScaledChar()`. Unset pixels are
+     * transparent
+    */
+    void drawScaledXBitmap(const uint8_t* const bitmap, int x, int y, int w, int h, uint8_t factor, const Color& c)
+    {
+        if (factor == 0 || factor > scale::MAX_FACTOR) return;
+
+        const auto& clip = this->clip();
+        if (clip.intersect(Rect{x, y, x + w * factor - 1, y + h * factor - 1}).empty()) return;
+
+        const uint8_t value = Mono1::fromColor(c);
+        const auto bytes_per_row = (w + 7) / 8;
+
+        for (auto band = 0; band < h; band += 8)
+        {
+            const uint8_t n = h - band < 8 ? h - band : 8;
+            const int py = y + band * factor;
+
+            // Skip bands outside the clip region
+            if (py > clip.y1 || py + n * factor - 1 < clip.y0) continue;
+
+            for (auto bx = 0; bx < bytes_per_row; ++bx)
+            {
+                // Up to 8 rows of one byte column
+                uint8_t rows[8];
+                auto cursor = this->reader().cursor(bitmap, band * bytes_per_row + bx);
+                for (uint8_t j = 0; j < n; ++j)
+                {
+                    rows[j] = cursor.next();
+                    cursor.skip(bytes_per_row - 1);
+                }
+
+                for (uint8_t k = 0; k < 8 && bx * 8 + k < w; ++k)
+                {
+                    uint8_t column = 0;
+                    for (uint8_t j = 0; j < n; ++j)
+                    {
+                        column |= ((rows[j] >> k) & 0x01) << j;
+                    }
+
+                    if (column)
+                    {
+                        writeScaledColumn(x + (bx * 8 + k) * factor, py, column, column, factor, false, value);
+                    }
+                }
+            }
+        }
+    }
+
+protected:
+    /**
+     * Write a column byte scaled by `factor` to `factor` columns starting at (x, y). Only the rows set in `valid`
+     * are written. Opaque writes store `bits` as is, otherwise the set bits are written with `value` and the rest is
+     * left unchanged
+    */
+    void writeScaledColumn(int x, int y, uint8_t bits, uint8_t valid, uint8_t factor, bool opaque, uint8_t value)
+    {
+        const auto& clip = this->clip();
+        if (x > clip.x1 || x + factor - 1 < clip.x0) return;
+
+        uint8_t data[scale::MAX_FACTOR];
+        uint8_t mask[scale::MAX_FACTOR];
+        scale::expand(bits, factor, data);
+        scale::expand(valid, factor, mask);
+
+        for (uint8_t k = 0; k < factor; ++k)
+        {
+            const int py = y + k * 8;
+            const uint8_t rows = clipRows(py) & mask[k];
+            if (!rows) continue;
+
+            for (uint8_t s = 0; s < factor; ++s)
+            {
+                const int col = x + s;
+                if (col < clip.x0 || col > clip.x1) continue;
+
+                if (!opaque)
+                {
+                    framebuffer_.writeColumnBits(col, py, rows & data[k], value);
+                }
+                else if (rows == 0xFF)
+                {
+                    framebuffer_.writeColumn(col, py, data[k]);
+                }
+                else
+                {
+                    framebuffer_.writeColumnBits(col, py, rows & data[k], 1);
+                    framebuffer_.writeColumnBits(col, py, rows & ~data[k], 0);
+                }
+            }
+        }
+    }
+
+    void drawPackedChar(const Font& font, const char c, int x, int y, const Color& color)
+    {
+        Glyph glyph;
+        if (!font.glyph(c, glyph, this->reader())) return;
+
+        const auto& clip = this->clip();
+        const int h = font.height();
+        const uint8_t fg = Mono1::fromColor(color) ? 0xFF : 0x00;
+        auto bits = font.bits(glyph, this->reader());
+
+        for (auto i = 0; i < glyph.advance; ++i)
+        {
+            const int col = x + i;
+            if (col > clip.x1) break;
+
+            for (auto row = 0; row < h; row += 8)
+            {
+                const uint8_t n = h - row < 8 ? h - row : 8;
+                const uint8_t column = i < glyph.width ? bits.next(n) & fg : 0;
+
+                if (col < clip.x0) continue;
+
+                const uint8_t rows = clipRows(y + row) & static_cast<uint8_t>(0xFF >> (8 - n));
+                if (rows == 0xFF)
+                {
+                    framebuffer_.writeColumn(col, y + row, column);
+                }
+                else if (rows)
+                {
+                    framebuffer_.writeColumnBits(col, y + row, rows & column, 1);
+                    framebuffer_.writeColumnBits(col, y + row, rows & ~column, 0);
+                }
+            }
+        }
+    }
+
+    /**
+     * Mask of the rows y to y + 7 that are inside the clip region, bit N is row y + N
+    */
+    uint8_t clipRows(int y) const
+    {
+        const auto& clip = this->clip();
+        const int top = clip.y0 - y;
+        const int bottom = clip.y1 - y;
+
+        if (bottom < 0 || top > 7) return 0;
+
+        uint8_t mask = 0xFF;
+        if (top > 0) mask &= static_cast<uint8_t>(0xFF << top);
+        if (bottom < 7) mask &= static_cast<uint8_t>(0xFF >> (7 - bottom));
+
+        return mask;
+    }
+
+    FrameBufferT framebuffer_;
+};
+
+/**
+ * Renders a full size display into a single page buffer.
+ *
+ * Drawing is done in display coordinates and everything outside the current page is clipped. Used to replay a
+ * `DisplayList` once per page.
+*/
+template<unsigned int W, class GfxDataReader>
+class PageRenderTarget : public PageRasterDisplay<PageRenderTarget<W, GfxDataReader>, PageWindow<W>, GfxDataReader>
+{
+    using Base = PageRasterDisplay<PageRenderTarget<W, GfxDataReader>, PageWindow<W>, GfxDataReader>;
+
+public:
+    PageRenderTarget(unsigned int width, unsigned int height, PageFrameBuffer<W, 1>& page)
+        : Base{width, height, page}
+    {
+    }
+
+    /**
+     * Select the page to render
+    */
+    void setPage(unsigned int page)
+    {
+        this->framebuffer_.setOrigin(page * 8);
+    }
+
+    void update()
+    {
+    }
+};
+
+}
+}
+
+#endif // FTL_GFX_PAGE_DISPLAY_HPP
@@ -0,0 +1,328 @@
+//
+// page_framebuffer.hpp
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+
+#ifndef FTL_GFX_PAGE_FRAMEBUFFER_HPP
+#define FTL_GFX_PAGE_FRAMEBUFFER_HPP
+
+#include <stdint.h>
+#include <string.h>
+
+namespace ftl
+{
+namespace gfx
+{
+
+/**
+ * Monochrome framebuffer organized in pages.
+ *
+ * Each page is a row of bytes, one per column, holding 8 vertical pixels (LSB is the top row of the page). This is
+ * the GDDRAM layout used by SSD1306 style controllers, which allows vertical runs within a page to be written as a
+ * single masked byte and filled rectangles as a memset per page.
+ *
+ * Span and rectangle operations take inclusive end points and are clipped to the framebuffer bounds.
+ *
+ * \tparam W Width in pixels
+ * \tparam PAGES Number of 8 pixel high pages
+*/
+template<unsigned int W, unsigned int PAGES>
+class PageFrameBuffer
+{
+public:
+    static constexpr unsigned int WIDTH = W;
+    static constexpr unsigned int NUM_PAGES = PAGES;
+    static constexpr unsigned int HEIGHT = PAGES * 8;
+    static constexpr unsigned int SIZE = W * PAGES;
+
+    /**
+     * Set every byte in the framebuffer to `value`
+    */
+    void clear(uint8_t value = 0x00)
+    {
+        memset(buffer_, value, sizeof(buffer_));
+    }
+
+    /**
+     * Set a single pixel. No bounds checking is done
+    */
+    void setPixel(unsigned int col, unsigned int row, uint8_t value)
+    {
+        auto& byte = buffer_[row / 8][col];
+        const auto page_row = row % 8;
+
+        byte = (byte & ~(1 << page_row)) | ((value & 0x01) << page_row);
+    }
+
+    /**
+     * Get a single pixel. No bounds checking is done
+    */
+    uint8_t getPixel(unsigned int col, unsigned int row) const
+    {
+        return (buffer_[row / 8][col] >> (row % 8)) & 0x01;
+    }
+
+    /**
+     * Fill the horizontal span [x0, x1] on row y
+    */
+    void fillHSpan(int x0, int x1, int y, uint8_t value)
+    {
+        if (x0 > x1) swap(x0, x1);
+        if (y < 0 || y >= static_cast<int>(HEIGHT)) return;
+        if (!clip(x0, x1, WIDTH)) return;
+
+        const uint8_t mask = 1 << (y & 7);
+        writeMasked(&buffer_[y / 8][x0], x1 - x0 + 1, mask, value);
+    }
+
+    /**
+     * Fill the vertical span [y0, y1] on column x
+    */
+    void fillVSpan(int x, int y0, int y1, uint8_t value)
+    {
+        if (y0 > y1) swap(y0, y1);
+        if (x < 0 || x >= static_cast<int>(WIDTH)) return;
+        if (!clip(y0, y1, HEIGHT)) return;
+
+        const auto p0 = static_cast<unsigned int>(y0) / 8;
+        const auto p1 = static_cast<unsigned int>(y1) / 8;
+
+        for (auto p = p0; p <= p1; ++p)
+        {
+            writeMasked(&buffer_[p][x], 1, pageMask(p, p0, p1, y0, y1), value);
+        }
+    }
+
+    /**
+     * Fill the rectangle with corners (x0, y0) and (x1, y1)
+    */
+    void fillRect(int x0, int y0, int x1, int y1, uint8_t value)
+    {
+        if (x0 > x1) swap(x0, x1);
+        if (y0 > y1) swap(y0, y1);
+        if (!clip(x0, x1, WIDTH) || !clip(y0, y1, HEIGHT)) return;
+
+        const auto p0 = static_cast<unsigned int>(y0) / 8;
+        const auto p1 = static_cast<unsigned int>(y1) / 8;
+        const auto len = static_cast<unsigned int>(x1 - x0 + 1);
+
+        for (auto p = p0; p <= p1; ++p)
+        {
+            writeMasked(&buffer_[p][x0], len, pageMask(p, p0, p1, y0, y1), value);
+        }
+    }
+
+    /**
+     * Write 8 vertical pixels at column x, starting at row y. Bit N of `bits` is row y + N.
+     *
+     * A page aligned write is a single byte store. Otherwise the bits are shifted and merged into the two pages the
+     * column crosses.
+    */
+    void writeColumn(int x, int y, uint8_t bits)
+    {
+        if (x < 0 || x >= static_cast<int>(WIDTH)) return;
+
+        // Arithmetic shift and mask give floor division for negative rows
+        const int p = y >> 3;
+        const uint8_t shift = y & 7;
+
+        if (shift == 0)
+        {
+            if (p >= 0 && p < static_cast<int>(PAGES))
+            {
+                buffer_[p][x] = bits;
+            }
+            return;
+        }
+
+        if (p >= 0 && p < static_cast<int>(PAGES))
+        {
+            auto& byte = buffer_[p][x];
+            byte = (byte & ~static_cast<uint8_t>(0xFF << shift)) | static_cast<uint8_t>(bits << shift);
+        }
+
+        if (p + 1 >= 0 && p + 1 < static_cast<int>(PAGES))
+        {
+            auto& byte = buffer_[p + 1][x];
+            byte = (byte & ~static_cast<uint8_t>(0xFF >> (8 - shift))) | static_cast<uint8_t>(bits >> (8 - shift));
+        }
+    }
+
+    /**
+     * Set the rows of column x selected by `bits`, starting at row y, to `value`. Other rows are left unchanged
+    */
+    void writeColumnBits(int x, int y, uint8_t bits, uint8_t value)
+    {
+        if (x < 0 || x >= static_cast<int>(WIDTH)) return;
+
+        const int p = y >> 3;
+        const uint8_t shift = y & 7;
+
+        if (p >= 0 && p < static_cast<int>(PAGES))
+        {
+            writeMasked(&buffer_[p][x], 1, static_cast<uint8_t>(bits << shift), value);
+        }
+
+        if (shift != 0 && p + 1 >= 0 && p + 1 < static_cast<int>(PAGES))
+        {
+            writeMasked(&buffer_[p + 1][x], 1, static_cast<uint8_t>(bits >> (8 - shift)), value);
+        }
+    }
+
+    uint8_t* page(unsigned int p)
+    {
+        return buffer_[p];
+    }
+
+    const uint8_t* page(unsigned int p) const
+    {
+        return buffer_[p];
+    }
+
+    uint8_t* data()
+    {
+        return &buffer_[0][0];
+    }
+
+    const uint8_t* data() const
+    {
+        return &buffer_[0][0];
+    }
+
+    constexpr unsigned int size() const
+    {
+        return SIZE;
+    }
+
+private:
+    static void swap(int& a, int& b)
+    {
+        const auto t = a;
+        a = b;
+        b = t;
+    }
+
+    /**
+     * Clip the inclusive range [a, b] to [0, limit). Returns false if nothing remains
+    */
+    static bool clip(int& a, int& b, unsigned int limit)
+    {
+        if (b < 0 || a >= static_cast<int>(limit)) return false;
+        if (a < 0) a = 0;
+        if (b >= static_cast<int>(limit)) b = limit - 1;
+        return true;
+    }
+
+    /**
+     * Mask of the rows in page `p` covered by the row range [y0, y1], which spans pages [p0, p1]
+    */
+    static uint8_t pageMask(unsigned int p, unsigned int p0, unsigned int p1, int y0, int y1)
+    {
+        uint8_t mask = 0xFF;
+        if (p == p0) mask &= static_cast<uint8_t>(0xFF << (y0 & 7));
+        if (p == p1) mask &= static_cast<uint8_t>(0xFF >> (7 - (y1 & 7)));
+        return mask;
+    }
+
+    static void writeMasked(uint8_t* dst, unsigned int len, uint8_t mask, uint8_t value)
+    {
+        if (mask == 0xFF)
+        {
+            memset(dst, value ? 0xFF : 0x00, len);
+        }
+        else if (value)
+        {
+            while (len--) *dst++ |= mask;
+        }
+        else
+        {
+            const uint8_t keep = ~mask;
+            while (len--) *dst++ &= keep;
+        }
+    }
+
+    uint8_t buffer_[PAGES][W];
+};
+
+/**
+ * A single page buffer positioned over a taller display.
+ *
+ * Exposes the same drawing operations as `PageFrameBuffer`, in display coordinates. Only the 8 rows starting at the
+ * origin are stored, everything else is clipped. Used to render a display one page at a time.
+ *
+ * \tparam W Width in pixels
+*/
+template<unsigned int W>
+class PageWindow
+{
+public:
+    using Page = PageFrameBuffer<W, 1>;
+
+    PageWindow(Page& page)
+        : page_{page}
+        , origin_{0}
+    {
+    }
+
+    /**
+     * Set the display row of the first row in the page
+    */
+    void setOrigin(int row)
+    {
+        origin_ = row;
+    }
+
+    int origin() const
+    {
+        return origin_;
+    }
+
+    void setPixel(unsigned int col, unsigned int row, uint8_t value)
+    {
+        const int page_row = static_cast<int>(row) - origin_;
+        if (col >= W || page_row < 0 || page_row >= 8) return;
+
+        page_.setPixel(col, page_row, value);
+    }
+
+    void fillHSpan(int x0, int x1, int y, uint8_t value)
+    {
+        page_.fillHSpan(x0, x1, y - origin_, value);
+    }
+
+    void fillVSpan(int x, int y0, int y1, uint8_t value)
+    {
+        page_.fillVSpan(x, y0 - origin_, y1 - origin_, value);
+    }
+
+    void fillRect(int x0, int y0, int x1, int y1, uint8_t value)
+    {
+        page_.fillRect(x0, y0 - origin_, x1, y1 - origin_, value);
+    }
+
+    void writeColumn(int x, int y, uint8_t bits)
+    {
+        page_.writeColumn(x, y - origin_, bits);
+    }
+
+    void writeColumnBits(int x, int y, uint8_t bits, uint8_t value)
+    {
+        page_.writeColumnBits(x, y - origin_, bits, value);
+    }
+
+    Page& page()
+    {
+        return page_;
+    }
+
+private:
+    Page& page_;
+    int origin_;
+};
+
+}
+}
+
+#endif // FTL_GFX_PAGE_FRAMEBUFFER_HPP
@@ -0,0 +1,88 @@
+//
+// pixel_format.hpp
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+
+#ifndef FTL_GFX_PIXEL_FORMAT_HPP
+#define FTL_GFX_PIXEL_FORMAT_HPP
+
+#include <stdint.h>
+
+#include <ftl/gfx/color.hpp>
+
+namespace ftl
+{
+namespace gfx
+{
+
+/**
+ * Pixel formats describe the packed value a display stores per pixel.
+ *
+ * Each format provides the native `Pixel` type, its size in bits and `fromColor()`, which converts a `Color` once at
+ * the drawing API boundary. Primitives then pass the native value to the display's `writePixel()` in their inner loops
+ * (see `StaticRasterDisplay`).
+*/
+
+/**
+ * Pass `Color` through unchanged. Default for displays that only implement `drawPixel(col, row, Color)`
+*/
+struct ColorFormat
+{
+    using Pixel = Color;
+    static constexpr uint8_t BITS_PER_PIXEL = 24;
+
+    static constexpr Pixel fromColor(const Color& c)
+    {
+        return c;
+    }
+};
+
+/**
+ * 1 bit monochrome. Any colour other than black is on
+*/
+struct Mono1
+{
+    using Pixel = uint8_t;
+    static constexpr uint8_t BITS_PER_PIXEL = 1;
+
+    static constexpr Pixel fromColor(const Color& c)
+    {
+        return c.monochrome();
+    }
+};
+
+/**
+ * 4 bit greyscale, 0 is black and 15 white
+*/
+struct Gray4
+{
+    using Pixel = uint8_t;
+    static constexpr uint8_t BITS_PER_PIXEL = 4;
+
+    static constexpr Pixel fromColor(const Color& c)
+    {
+        // Integer luma (BT.601 weights scaled by 256), reduced to 4 bits
+        return static_cast<Pixel>((c.r * 77u + c.g * 150u + c.b * 29u) >> 12);
+    }
+};
+
+/**
+ * 16 bit colour, 5 bits red, 6 bits green, 5 bits blue
+*/
+struct Rgb565
+{
+    using Pixel = uint16_t;
+    static constexpr uint8_t BITS_PER_PIXEL = 16;
+
+    static constexpr Pixel fromColor(const Color& c)
+    {
+        return static_cast<Pixel>(((c.r & 0xF8u) << 8) | ((c.g & 0xFCu) << 3) | (c.b >> 3));
+    }
+};
+
+}
+}
+
+#endif // FTL_GFX_PIXEL_FORMAT_HPP
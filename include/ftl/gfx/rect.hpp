@@ -0,0 +1,79 @@
+//
+// rect.hpp
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+
+#ifndef FTL_GFX_RECT_HPP
+#define FTL_GFX_RECT_HPP
+
+namespace ftl
+{
+namespace gfx
+{
+
+/**
+ * Rectangle with inclusive corners (x0, y0) and (x1, y1). Empty if x1 < x0 or y1 < y0
+*/
+struct Rect
+{
+    int x0;
+    int y0;
+    int x1;
+    int y1;
+
+    bool empty() const
+    {
+        return x1 < x0 || y1 < y0;
+    }
+
+    bool contains(int x, int y) const
+    {
+        return x >= x0 && x <= x1 && y >= y0 && y <= y1;
+    }
+
+    int width() const
+    {
+        return x1 - x0 + 1;
+    }
+
+    int height() const
+    {
+        return y1 - y0 + 1;
+    }
+
+    /**
+     * Area covered by both rectangles
+    */
+    Rect intersect(const Rect& r) const
+    {
+        return Rect{
+            x0 > r.x0 ? x0 : r.x0,
+            y0 > r.y0 ? y0 : r.y0,
+            x1 < r.x1 ? x1 : r.x1,
+            y1 < r.y1 ? y1 : r.y1,
+        };
+    }
+
+    /**
+     * Smallest rectangle containing both rectangles. Empty rectangles are ignored
+    */
+    Rect unite(const Rect& r) const
+    {
+        if (empty()) return r;
+        if (r.empty()) return *this;
+
+        return Rect{
+            x0 < r.x0 ? x0 : r.x0,
+            y0 < r.y0 ? y0 : r.y0,
+            x1 > r.x1 ? x1 : r.x1,
+            y1 > r.y1 ? y1 : r.y1,
+        };
+    }
+};
+
+}
+}
+
+#endif // FTL_GFX_RECT_HPP
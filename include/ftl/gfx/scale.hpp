@@ -0,0 +1,92 @@
+//
+// scale.hpp
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+
+#ifndef FTL_GFX_SCALE_HPP
+#define FTL_GFX_SCALE_HPP
+
+#include <stdint.h>
+
+#include <ftl/memory/flash.hpp>
+
+namespace ftl
+{
+namespace gfx
+{
+
+/**
+ * Integer scaling of 1 bit pixel data.
+ *
+ * A column byte (8 pixels, LSB at the top) scaled by N becomes N bytes with each bit repeated N times. The expansion
+ * is a table lookup per nibble, so a scaled glyph column is written as whole page bytes instead of N * N pixels per
+ * source pixel.
+*/
+namespace scale
+{
+    static constexpr uint8_t MAX_FACTOR = 4;
+
+    // Bit N of the index repeated in bits 2N and 2N + 1
+    static const uint8_t DOUBLE_NIBBLE[16] FTL_FLASH = {
+        0x00, 0x03, 0x0C, 0x0F, 0x30, 0x33, 0x3C, 0x3F, 0xC0, 0xC3, 0xCC, 0xCF, 0xF0, 0xF3, 0xFC, 0xFF,
+    };
+
+    // Bit N of the index repeated in bits 3N to 3N + 2. 12 bit values, little endian
+    static const uint8_t TRIPLE_NIBBLE[32] FTL_FLASH = {
+        0x00, 0x00, 0x07, 0x00, 0x38, 0x00, 0x3F, 0x00, 0xC0, 0x01, 0xC7, 0x01, 0xF8, 0x01, 0xFF, 0x01,
+        0x00, 0x0E, 0x07, 0x0E, 0x38, 0x0E, 0x3F, 0x0E, 0xC0, 0x0F, 0xC7, 0x0F, 0xF8, 0x0F, 0xFF, 0x0F,
+    };
+
+    /**
+     * Expand the 8 bits of `bits` by `factor` (1 to MAX_FACTOR) into `factor` bytes, LSB first
+    */
+    inline void expand(uint8_t bits, uint8_t factor, uint8_t* out)
+    {
+        const memory::FlashReader flash{};
+        const uint8_t lo = bits & 0x0F;
+        const uint8_t hi = bits >> 4;
+
+        switch (factor)
+        {
+        case 2:
+            out[0] = flash(DOUBLE_NIBBLE, lo);
+            out[1] = flash(DOUBLE_NIBBLE, hi);
+            break;
+        case 3:
+        {
+            // Two 12 bit halves packed into 3 bytes
+            const uint8_t lo0 = flash(TRIPLE_NIBBLE, lo * 2);
+            const uint8_t lo1 = flash(TRIPLE_NIBBLE, lo * 2 + 1);
+            const uint8_t hi0 = flash(TRIPLE_NIBBLE, hi * 2);
+            const uint8_t hi1 = flash(TRIPLE_NIBBLE, hi * 2 + 1);
+
+            out[0] = lo0;
+            out[1] = lo1 | static_cast<uint8_t>(hi0 << 4);
+            out[2] = static_cast<uint8_t>(hi0 >> 4) | static_cast<uint8_t>(hi1 << 4);
+            break;
+        }
+        case 4:
+        {
+            // Doubled twice
+            const uint8_t d0 = flash(DOUBLE_NIBBLE, lo);
+            const uint8_t d1 = flash(DOUBLE_NIBBLE, hi);
+
+            out[0] = flash(DOUBLE_NIBBLE, d0 & 0x0F);
+            out[1] = flash(DOUBLE_NIBBLE, d0 >> 4);
+            out[2] = flash(DOUBLE_NIBBLE, d1 & 0x0F);
+            out[3] = flash(DOUBLE_NIBBLE, d1 >> 4);
+            break;
+        }
+        default:
+            out[0] = bits;
+            break;
+        }
+    }
+}
+
+}
+}
+
+#endif // FTL_GFX_SCALE_HPP
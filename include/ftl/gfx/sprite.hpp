@@ -0,0 +1,133 @@
+//
+// sprite.hpp
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+
+#ifndef FTL_GFX_SPRITE_HPP
+#define FTL_GFX_SPRITE_HPP
+
+#include <stdint.h>
+
+namespace ftl
+{
+namespace gfx
+{
+
+/**
+ * Page packed, run length encoded monochrome sprites.
+ *
+ * |width|height|runs for page row 0|runs for page row 1|...
+ *
+ * The image is split into rows of 8 pixels (page rows). Each column of a page row is one byte, LSB at the top, the same
+ * layout as SSD1306 GDDRAM. The column bytes of each page row are encoded as runs, which never cross a page row:
+ *
+ * 00LLLLLL          - Skip L + 1 transparent (zero) columns
+ * 01LLLLLL B        - Repeat B for L + 1 columns
+ * 10LLLLLL B0...BL  - L + 1 literal column bytes
+ *
+ * Animations are stored as frame sets, a frame count and a table of 16 bit little endian offsets to each frame:
+ *
+ * |count|offset of frame 0|...|offset of frame count - 1|frame 0|frame 1|...
+ *
+ * Sprites and frame sets are generated from XBM images by `scripts/xbm2sprite.py`.
+*/
+namespace sprite
+{
+    static constexpr uint8_t HEADER_SIZE = 2;
+    static constexpr uint8_t FRAME_SET_HEADER_SIZE = 1;
+    static constexpr uint8_t FRAME_OFFSET_SIZE = 2;
+
+    static constexpr uint8_t RUN_SKIP = 0x00;
+    static constexpr uint8_t RUN_REPEAT = 0x40;
+    static constexpr uint8_t RUN_LITERAL = 0x80;
+
+    static constexpr uint8_t RUN_TYPE_MASK = 0xC0;
+    static constexpr uint8_t RUN_LENGTH_MASK = 0x3F;
+
+    template<class Reader>
+    uint8_t width(const uint8_t* sprite, const Reader& reader)
+    {
+        return reader(sprite, 0);
+    }
+
+    template<class Reader>
+    uint8_t height(const uint8_t* sprite, const Reader& reader)
+    {
+        return reader(sprite, 1);
+    }
+
+    /**
+     * @return number of frames in a frame set
+    */
+    template<class Reader>
+    uint8_t frameCount(const uint8_t* frames, const Reader& reader)
+    {
+        return reader(frames, 0);
+    }
+
+    /**
+     * @return sprite of frame `i` of a frame set
+    */
+    template<class Reader>
+    const uint8_t* frame(const uint8_t* frames, uint8_t i, const Reader& reader)
+    {
+        const auto entry = FRAME_SET_HEADER_SIZE + i * FRAME_OFFSET_SIZE;
+        const uint16_t offset = reader(frames, entry) | (static_cast<uint16_t>(reader(frames, entry + 1)) << 8);
+
+        return frames + offset;
+    }
+
+    /**
+     * Decode a sprite, calling `fn(col, page_row, bits)` for every column byte that is not transparent
+    */
+    template<class Reader, class Fn>
+    void decode(const uint8_t* sprite, const Reader& reader, Fn fn)
+    {
+        const uint8_t w = width(sprite, reader);
+        const uint8_t page_rows = (height(sprite, reader) + 7) / 8;
+
+        auto cursor = reader.cursor(sprite, HEADER_SIZE);
+
+        for (uint8_t page_row = 0; page_row < page_rows; ++page_row)
+        {
+            uint8_t col = 0;
+
+            while (col < w)
+            {
+                const uint8_t run = cursor.next();
+                const uint8_t len = (run & RUN_LENGTH_MASK) + 1;
+
+                switch (run & RUN_TYPE_MASK)
+                {
+                case RUN_REPEAT:
+                {
+                    const uint8_t bits = cursor.next();
+                    for (uint8_t i = 0; i < len; ++i)
+                    {
+                        fn(col + i, page_row, bits);
+                    }
+                    break;
+                }
+                case RUN_LITERAL:
+                    for (uint8_t i = 0; i < len; ++i)
+                    {
+                        fn(col + i, page_row, cursor.next());
+                    }
+                    break;
+                default:
+                    // Transparent run
+                    break;
+                }
+
+                col += len;
+            }
+        }
+    }
+}
+
+}
+}
+
+#endif // FTL_GFX_SPRITE_HPP
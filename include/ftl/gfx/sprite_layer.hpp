@@ -0,0 +1,336 @@
+//
+// sprite_layer.hpp
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+
+#ifndef FTL_GFX_SPRITE_LAYER_HPP
+#define FTL_GFX_SPRITE_LAYER_HPP
+
+#include <stdint.h>
+
+#include <ftl/gfx/color.hpp>
+#include <ftl/gfx/rect.hpp>
+#include <ftl/gfx/sprite.hpp>
+#include <ftl/memory/memreader.hpp>
+
+namespace ftl
+{
+namespace gfx
+{
+
+template<class GfxReader>
+class SpriteLayer;
+
+/**
+ * Animated sprite with a position and velocity.
+ *
+ * Frames come from a frame set (see `gfx/sprite.hpp`), which can stay in flash. Positions and velocities are fixed
+ * point with `SUBPIXEL_BITS` fractional bits, so slow sprites can move less than a pixel per step.
+ *
+ * \tparam GfxReader Method of reading the frame set
+*/
+template<class GfxReader = memory::DefaultMemoryReader>
+class AnimatedSprite
+{
+public:
+    static constexpr uint8_t SUBPIXEL_BITS = 4;
+
+    /**
+     * \param frames Frame set
+     * \param ticks Layer steps each frame is shown for
+    */
+    AnimatedSprite(const uint8_t* frames, int x, int y, uint8_t ticks = 1, const Color& color = Color::white())
+        : frames_{frames}
+        , x_{x * (1 << SUBPIXEL_BITS)}
+        , y_{y * (1 << SUBPIXEL_BITS)}
+        , vx_{0}
+        , vy_{0}
+        , color_{color}
+        , frame_{0}
+        , ticks_{ticks ? ticks : static_cast<uint8_t>(1)}
+        , tick_{0}
+        , visible_{true}
+        , changed_{true}
+        , drawn_{0, 0, -1, -1}
+        , next_{nullptr}
+    {
+    }
+
+    void setPosition(int x, int y)
+    {
+        x_ = x * (1 << SUBPIXEL_BITS);
+        y_ = y * (1 << SUBPIXEL_BITS);
+        changed_ = true;
+    }
+
+    /**
+     * Set the velocity in 1 / 2^SUBPIXEL_BITS pixels per step
+    */
+    void setVelocity(int vx, int vy)
+    {
+        vx_ = vx;
+        vy_ = vy;
+    }
+
+    /**
+     * Switch to another frame set, starting from its first frame
+    */
+    void setFrames(const uint8_t* frames, uint8_t ticks = 1)
+    {
+        frames_ = frames;
+        frame_ = 0;
+        ticks_ = ticks ? ticks : 1;
+        tick_ = 0;
+        changed_ = true;
+    }
+
+    void setVisible(bool visible)
+    {
+        changed_ = changed_ || visible != visible_;
+        visible_ = visible;
+    }
+
+    int x() const
+    {
+        return x_ >> SUBPIXEL_BITS;
+    }
+
+    int y() const
+    {
+        return y_ >> SUBPIXEL_BITS;
+    }
+
+    int vx() const
+    {
+        return vx_;
+    }
+
+    int vy() const
+    {
+        return vy_;
+    }
+
+    uint8_t frame() const
+    {
+        return frame_;
+    }
+
+    bool visible() const
+    {
+        return visible_;
+    }
+
+    /**
+     * @return area covered by the current frame
+    */
+    Rect bounds(const GfxReader& reader) const
+    {
+        const auto* sprite = current(reader);
+        return Rect{x(), y(), x() + sprite::width(sprite, reader) - 1, y() + sprite::height(sprite, reader) - 1};
+    }
+
+private:
+    friend class SpriteLayer<GfxReader>;
+
+    const uint8_t* current(const GfxReader& reader) const
+    {
+        return sprite::frame(frames_, frame_, reader);
+    }
+
+    /**
+     * Move and advance the animation
+    */
+    void step(const GfxReader& reader)
+    {
+        const int x0 = x();
+        const int y0 = y();
+
+        x_ += vx_;
+        y_ += vy_;
+        changed_ = changed_ || x() != x0 || y() != y0;
+
+        if (++tick_ >= ticks_)
+        {
+            tick_ = 0;
+
+            const uint8_t count = sprite::frameCount(frames_, reader);
+            if (count > 1)
+            {
+                frame_ = (frame_ + 1) % count;
+                changed_ = true;
+            }
+        }
+    }
+
+    const uint8_t* frames_;
+
+    int x_;
+    int y_;
+    int vx_;
+    int vy_;
+
+    Color color_;
+
+    uint8_t frame_;
+    uint8_t ticks_;
+    uint8_t tick_;
+
+    bool visible_;
+    bool changed_;
+
+    // Area the sprite was last drawn to, empty if not drawn
+    Rect drawn_;
+
+    AnimatedSprite* next_;
+};
+
+/**
+ * Sprites drawn over a static background, redrawn only where they change.
+ *
+ * Each `render()` restores the background over the union of a changed sprite's old and new bounds, draws the sprites
+ * covering that area and reports it for a partial update. Moving a few small sprites sends a few small windows
+ * instead of the whole frame:
+ *
+ *   SpriteLayer<> layer{background};
+ *   AnimatedSprite<> ball{ball_frames, 0, 0, 4};
+ *   ball.setVelocity(24, 8);
+ *   layer.add(ball);
+ *
+ *   for (;;)
+ *   {
+ *       layer.step();
+ *       layer.render(display);
+ *   }
+ *
+ * The background is a sprite drawn at the origin, or black if null. The layer owns the area under its sprites, other
+ * drawing there is overwritten when a sprite moves over it.
+ *
+ * \tparam GfxReader Method of reading sprite data. Must match the display's reader
+*/
+template<class GfxReader = memory::DefaultMemoryReader>
+class SpriteLayer
+{
+public:
+    using Sprite = AnimatedSprite<GfxReader>;
+
+    explicit SpriteLayer(const uint8_t* background = nullptr, const Color& color = Color::white())
+        : background_{background}
+        , color_{color}
+        , head_{nullptr}
+        , reader_{}
+    {
+    }
+
+    /**
+     * Add a sprite. Sprites are linked in place and must outlive the layer. Later sprites are drawn on top
+    */
+    void add(Sprite& s)
+    {
+        Sprite** tail = &head_;
+        while (*tail) tail = &(*tail)->next_;
+
+        s.next_ = nullptr;
+        s.changed_ = true;
+        *tail = &s;
+    }
+
+    /**
+     * Advance every sprite by its velocity and animation
+    */
+    void step()
+    {
+        for (auto* s = head_; s; s = s->next_)
+        {
+            s->step(reader_);
+        }
+    }
+
+    /**
+     * Redraw the changed areas and pass each one to `fn(area)`
+    */
+    template<class Display, class Fn>
+    void render(Display& display, Fn fn)
+    {
+        const Rect screen{0, 0, static_cast<int>(display.width()) - 1, static_cast<int>(display.height()) - 1};
+
+        for (auto* s = head_; s; s = s->next_)
+        {
+            if (!s->changed_) continue;
+
+            const Rect next = s->visible_ ? s->bounds(reader_) : Rect{0, 0, -1, -1};
+            const Rect area = s->drawn_.unite(next).intersect(screen);
+
+            // Clip stack is full, redraw the sprite next time
+            if (!area.empty() && !display.pushClip(area)) continue;
+
+            s->drawn_ = next;
+            s->changed_ = false;
+
+            if (area.empty()) continue;
+
+            restore(display, area);
+            display.popClip();
+
+            fn(area);
+        }
+    }
+
+    /**
+     * Redraw the changed areas and send them with `updateRegion()`
+    */
+    template<class Display>
+    void render(Display& display)
+    {
+        render(display, [&display](const Rect& area) { display.updateRegion(area); });
+    }
+
+    /**
+     * Draw the background and every sprite over the whole display, e.g. for the first frame. Send it with `update()`
+    */
+    template<class Display>
+    void redraw(Display& display)
+    {
+        const Rect screen{0, 0, static_cast<int>(display.width()) - 1, static_cast<int>(display.height()) - 1};
+        restore(display, screen);
+
+        for (auto* s = head_; s; s = s->next_)
+        {
+            s->drawn_ = s->visible_ ? s->bounds(reader_) : Rect{0, 0, -1, -1};
+            s->changed_ = false;
+        }
+    }
+
+private:
+    /**
+     * Background and sprites inside the current clip region
+    */
+    template<class Display>
+    void restore(Display& display, const Rect& area)
+    {
+        display.drawFillRect(area.x0, area.y0, area.width() - 1, area.height() - 1, Color::black());
+        if (background_) display.drawSprite(background_, 0, 0, color_);
+
+        for (auto* s = head_; s; s = s->next_)
+        {
+            if (!s->visible_) continue;
+
+            const Rect bounds = s->bounds(reader_);
+            if (bounds.intersect(area).empty()) continue;
+
+            display.drawSprite(s->current(reader_), bounds.x0, bounds.y0, s->color_);
+        }
+    }
+
+    const uint8_t* background_;
+    Color color_;
+
+    Sprite* head_;
+    GfxReader reader_;
+};
+
+}
+}
+
+#endif // FTL_GFX_SPRITE_LAYER_HPP
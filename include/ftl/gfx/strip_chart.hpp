@@ -0,0 +1,184 @@
+//
+// strip_chart.hpp
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+
+#ifndef FTL_GFX_STRIP_CHART_HPP
+#define FTL_GFX_STRIP_CHART_HPP
+
+#include <stdint.h>
+
+#include <ftl/drivers/displays/ssd1306.hpp>
+
+namespace ftl
+{
+namespace gfx
+{
+
+/**
+ * Live strip chart drawn directly into the panel GDDRAM of a page addressed panel (SSD1306).
+ *
+ * The chart sweeps across its area like an oscilloscope trace. Each sample is plotted in the column after the previous
+ * one. The trace wraps back to the left edge at the end, and the column ahead of it is blanked to mark the newest
+ * sample. Old samples are never redrawn. A sample costs one address window and two columns of data (2 * PAGES bytes),
+ * however many samples are on screen.
+ *
+ * Consecutive samples are joined with a vertical span so the trace stays continuous.
+ *
+ * \tparam Driver Page addressed driver (`drivers::Ssd1306`)
+ * \tparam PAGES Height of the chart in panel pages (8 pixels each)
+*/
+template<class Driver, uint8_t PAGES = 8>
+class StripChart
+{
+public:
+    static constexpr uint8_t HEIGHT = PAGES * 8;
+
+    /**
+     * \param driver Panel driver
+     * \param x First panel column of the chart
+     * \param width Width of the chart in columns
+     * \param page First panel page of the chart
+    */
+    StripChart(Driver& driver, uint8_t x, uint8_t width, uint8_t page)
+        : driver_{driver}
+        , x_{x}
+        , width_{width}
+        , page_{page}
+        , head_{0}
+        , last_row_{NO_SAMPLE}
+        , min_{0}
+        , max_{HEIGHT - 1}
+    {
+    }
+
+    /**
+     * Set the values plotted at the bottom and at the top of the chart. Samples outside the range are clamped
+    */
+    void setRange(int min, int max)
+    {
+        min_ = min;
+        max_ = max > min ? max : min + 1;
+    }
+
+    /**
+     * Blank the chart area and restart the trace at the left edge. Switches the panel to horizontal addressing, which
+     * windowed writes need
+    */
+    void clear()
+    {
+        const uint8_t blank[PAGES] = {0};
+
+        driver_.setAddresingMode(drivers::Ssd1306_AddressingMode::Horizontal);
+        driver_.setWindow(x_, x_ + width_ - 1, page_, page_ + PAGES - 1);
+
+        driver_.beginData();
+        for (auto i = 0u; i < width_; ++i)
+        {
+            driver_.writeData(blank, sizeof(blank));
+        }
+        driver_.endData();
+
+        head_ = 0;
+        last_row_ = NO_SAMPLE;
+    }
+
+    /**
+     * Plot the next sample
+    */
+    void plot(int value)
+    {
+        const uint8_t row = valueRow(value);
+
+        // Join the previous sample to this one
+        uint8_t top = row;
+        uint8_t bottom = row;
+        if (last_row_ != NO_SAMPLE)
+        {
+            if (last_row_ < top) top = last_row_;
+            if (last_row_ > bottom) bottom = last_row_;
+        }
+
+        const bool wrap = head_ == width_ - 1;
+        const uint8_t x = x_ + head_;
+        const uint8_t n = wrap ? 1 : 2;
+
+        // The trace column and the blank cursor column after it share a window. In horizontal addressing the window is
+        // filled page by page, so the two columns interleave
+        uint8_t data[PAGES * 2] = {0};
+        for (uint8_t p = 0; p < PAGES; ++p)
+        {
+            data[p * n] = spanBits(top, bottom, p * 8);
+        }
+
+        driver_.setWindow(x, x + n - 1, page_, page_ + PAGES - 1);
+        driver_.sendBuffer(data, PAGES * n);
+
+        if (wrap)
+        {
+            // The cursor column wraps to the left edge
+            const uint8_t blank[PAGES] = {0};
+            driver_.setWindow(x_, x_, page_, page_ + PAGES - 1);
+            driver_.sendBuffer(blank, sizeof(blank));
+        }
+
+        head_ = wrap ? 0 : head_ + 1;
+        last_row_ = row;
+    }
+
+    /**
+     * @return the chart column the next sample is plotted in
+    */
+    uint8_t head() const
+    {
+        return head_;
+    }
+
+private:
+    static constexpr uint8_t NO_SAMPLE = 0xFF;
+
+    /**
+     * Chart row of a value, 0 at the top
+    */
+    uint8_t valueRow(int value) const
+    {
+        if (value <= min_) return HEIGHT - 1;
+        if (value >= max_) return 0;
+
+        const long offset = (static_cast<long>(value) - min_) * (HEIGHT - 1) / (static_cast<long>(max_) - min_);
+        return static_cast<uint8_t>(HEIGHT - 1 - offset);
+    }
+
+    /**
+     * Bits of the span top to bottom that fall in the page starting at row y
+    */
+    static uint8_t spanBits(uint8_t top, uint8_t bottom, uint8_t y)
+    {
+        if (bottom < y || top > y + 7) return 0;
+
+        uint8_t bits = 0xFF;
+        if (top > y) bits &= static_cast<uint8_t>(0xFF << (top - y));
+        if (bottom < y + 7) bits &= static_cast<uint8_t>(0xFF >> (y + 7 - bottom));
+
+        return bits;
+    }
+
+    Driver& driver_;
+
+    uint8_t x_;
+    uint8_t width_;
+    uint8_t page_;
+
+    uint8_t head_;
+    uint8_t last_row_;
+
+    int min_;
+    int max_;
+};
+
+}
+}
+
+#endif // FTL_GFX_STRIP_CHART_HPP
@@ -0,0 +1,345 @@
+//
+// text_console.hpp
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+
+#ifndef FTL_GFX_TEXT_CONSOLE_HPP
+#define FTL_GFX_TEXT_CONSOLE_HPP
+
+#include <stdint.h>
+#include <string.h>
+
+#include <ftl/gfx/font.hpp>
+#include <ftl/memory/memreader.hpp>
+
+#include <ftl/drivers/displays/ssd1306.hpp>
+
+namespace ftl
+{
+namespace gfx
+{
+
+/**
+ * Character cell text console for page addressed panels (SSD1306).
+ *
+ * Keeps a COLS x ROWS grid of cells (character and attributes) instead of a framebuffer. Each cell is an 8x8 glyph
+ * occupying 8 columns of one panel page, so a cell maps directly to 8 bytes of GDDRAM. Writing to the console only
+ * marks the cells that changed. `flush()` renders the changed cells and sends them, with one address window per run
+ * of changed cells in a row. Updating a status line costs the bytes of the characters that changed.
+ *
+ * The console writes to the panel through the driver and does not need a framebuffer. It should not share pages with
+ * a framebuffer display, whose updates would overwrite the console.
+ *
+ * The font must be an 8x8 `Rows` or `Pages` font. Proportional (`Packed`) fonts do not fit the cell grid.
+ *
+ * \tparam Driver Page addressed driver (`drivers::Ssd1306`)
+ * \tparam COLS Number of columns. COLS * 8 must not exceed the panel width
+ * \tparam ROWS Number of rows. Must not exceed the number of panel pages
+ * \tparam GfxReader Method of reading the font data
+*/
+template<class Driver, uint8_t COLS = 16, uint8_t ROWS = 8, class GfxReader = memory::DefaultMemoryReader>
+class TextConsole
+{
+public:
+    static constexpr uint8_t NUM_COLS = COLS;
+    static constexpr uint8_t NUM_ROWS = ROWS;
+    static constexpr uint8_t CELL_WIDTH = 8;
+
+    // Cell attributes
+    static constexpr uint8_t ATTR_NONE = 0x00;
+    static constexpr uint8_t ATTR_INVERSE = 0x01;
+    static constexpr uint8_t ATTR_UNDERLINE = 0x02;
+
+    // Clean cells between two changed runs that are resent rather than starting another window. Setting a window
+    // costs about as much as a cell of data.
+    static constexpr uint8_t MERGE_GAP = 1;
+
+    TextConsole(Driver& driver, const Font* font)
+        : driver_{driver}
+        , font_{font}
+        , cursor_col_{0}
+        , cursor_row_{0}
+        , attr_{ATTR_NONE}
+    {
+        memset(cells_, ' ', sizeof(cells_));
+        memset(attrs_, ATTR_NONE, sizeof(attrs_));
+        invalidate();
+    }
+
+    /**
+     * Switch the panel to horizontal addressing, which windowed writes need, and redraw every cell on the next flush.
+     * Call after the panel is initialized.
+    */
+    void initialize()
+    {
+        driver_.setAddresingMode(drivers::Ssd1306_AddressingMode::Horizontal);
+        invalidate();
+    }
+
+    /**
+     * Set a cell. The cell is only marked changed if its character or attributes differ
+    */
+    void setCell(uint8_t col, uint8_t row, char c, uint8_t attr)
+    {
+        if (col >= COLS || row >= ROWS) return;
+
+        if (cells_[row][col] != c || attrs_[row][col] != attr)
+        {
+            cells_[row][col] = c;
+            attrs_[row][col] = attr;
+            markDirty(col, row);
+        }
+    }
+
+    char getChar(uint8_t col, uint8_t row) const
+    {
+        return cells_[row][col];
+    }
+
+    uint8_t getAttributes(uint8_t col, uint8_t row) const
+    {
+        return attrs_[row][col];
+    }
+
+    /**
+     * Move the cursor used by `put()` and `print()`
+    */
+    void setCursor(uint8_t col, uint8_t row)
+    {
+        cursor_col_ = col < COLS ? col : COLS - 1;
+        cursor_row_ = row < ROWS ? row : ROWS - 1;
+    }
+
+    /**
+     * Set the attributes of characters written by `put()` and `print()`
+    */
+    void setAttributes(uint8_t attr)
+    {
+        attr_ = attr;
+    }
+
+    /**
+     * Write a character at the cursor and advance it. Lines wrap at the last column and the cursor returns to the top
+     * row after the last
+    */
+    void put(char c)
+    {
+        if (c == '\n')
+        {
+            newLine();
+        }
+        else if (c == '\r')
+        {
+            cursor_col_ = 0;
+        }
+        else
+        {
+            setCell(cursor_col_, cursor_row_, c, attr_);
+
+            if (++cursor_col_ >= COLS)
+            {
+                newLine();
+            }
+        }
+    }
+
+    /**
+     * Write a string at the cursor
+    */
+    void print(const char* str)
+    {
+        while (*str)
+        {
+            put(*str++);
+        }
+    }
+
+    /**
+     * Write a string at (col, row) without moving the cursor. Text past the last column is dropped
+    */
+    void print(uint8_t col, uint8_t row, const char* str, uint8_t attr = ATTR_NONE)
+    {
+        for (; *str && col < COLS; ++col)
+        {
+            setCell(col, row, *str++, attr);
+        }
+    }
+
+    /**
+     * Fill columns col to col + n - 1 of a row with spaces
+    */
+    void clearRange(uint8_t col, uint8_t row, uint8_t n, uint8_t attr = ATTR_NONE)
+    {
+        for (; n > 0 && col < COLS; --n, ++col)
+        {
+            setCell(col, row, ' ', attr);
+        }
+    }
+
+    /**
+     * Blank every cell and home the cursor
+    */
+    void clear()
+    {
+        for (auto row = 0u; row < ROWS; ++row)
+        {
+            clearRange(0, row, COLS);
+        }
+
+        setCursor(0, 0);
+    }
+
+    /**
+     * Mark every cell changed, e.g. after the panel RAM was written by other means
+    */
+    void invalidate()
+    {
+        memset(dirty_, 0xFF, sizeof(dirty_));
+    }
+
+    /**
+     * @return true if any cell changed since the last flush
+    */
+    bool dirty() const
+    {
+        for (auto row = 0u; row < ROWS; ++row)
+        {
+            for (auto i = 0u; i < DIRTY_BYTES; ++i)
+            {
+                if (dirty_[row][i]) return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * Send the changed cells to the panel
+    */
+    void flush()
+    {
+        if (!font_) return;
+
+        for (uint8_t row = 0; row < ROWS; ++row)
+        {
+            uint8_t col = 0;
+
+            while (col < COLS)
+            {
+                // Find the next changed run
+                while (col < COLS && !isDirty(col, row)) ++col;
+                if (col == COLS) break;
+
+                const uint8_t start = col;
+                uint8_t end = col;
+
+                // Extend it over changes at most MERGE_GAP clean cells apart
+                for (++col; col < COLS; ++col)
+                {
+                    if (isDirty(col, row))
+                    {
+                        end = col;
+                    }
+                    else if (col - end > MERGE_GAP)
+                    {
+                        break;
+                    }
+                }
+
+                sendCells(start, end, row);
+                col = end + 1;
+            }
+
+            memset(dirty_[row], 0, sizeof(dirty_[row]));
+        }
+    }
+
+private:
+    static constexpr uint8_t DIRTY_BYTES = (COLS + 7) / 8;
+
+    void newLine()
+    {
+        cursor_col_ = 0;
+        cursor_row_ = (cursor_row_ + 1) % ROWS;
+    }
+
+    void markDirty(uint8_t col, uint8_t row)
+    {
+        dirty_[row][col / 8] |= (1 << (col % 8));
+    }
+
+    bool isDirty(uint8_t col, uint8_t row) const
+    {
+        return dirty_[row][col / 8] & (1 << (col % 8));
+    }
+
+    /**
+     * Render and send cells start to end of a row in one address window and one data transaction
+    */
+    void sendCells(uint8_t start, uint8_t end, uint8_t row)
+    {
+        driver_.setWindow(start * CELL_WIDTH, end * CELL_WIDTH + CELL_WIDTH - 1, row, row);
+
+        driver_.beginData();
+
+        for (auto col = start; col <= end; ++col)
+        {
+            uint8_t glyph[CELL_WIDTH];
+            renderCell(glyph, cells_[row][col], attrs_[row][col]);
+            driver_.writeData(glyph, sizeof(glyph));
+        }
+
+        driver_.endData();
+    }
+
+    /**
+     * Render a cell to 8 GDDRAM column bytes (LSB at the top)
+    */
+    void renderCell(uint8_t* columns, char c, uint8_t attr) const
+    {
+        uint8_t glyph[CELL_WIDTH];
+        reader_.read(glyph, font_->data() + font_->offset(c), sizeof(glyph));
+
+        for (uint8_t x = 0; x < CELL_WIDTH; ++x)
+        {
+            uint8_t column = 0;
+
+            if (font_->layout() == FontLayout::Pages)
+            {
+                column = glyph[x];
+            }
+            else
+            {
+                // Gather column x from the rows
+                for (uint8_t y = 0; y < 8; ++y)
+                {
+                    column |= ((glyph[y] >> x) & 0x01) << y;
+                }
+            }
+
+            if (attr & ATTR_UNDERLINE) column |= 0x80;
+            if (attr & ATTR_INVERSE) column = ~column;
+
+            columns[x] = column;
+        }
+    }
+
+    Driver& driver_;
+    const Font* font_;
+    GfxReader reader_;
+
+    char cells_[ROWS][COLS];
+    uint8_t attrs_[ROWS][COLS];
+    uint8_t dirty_[ROWS][DIRTY_BYTES];
+
+    uint8_t cursor_col_;
+    uint8_t cursor_row_;
+    uint8_t attr_;
+};
+
+}
+}
+
+#endif // FTL_GFX_TEXT_CONSOLE_HPP
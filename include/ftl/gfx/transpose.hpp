@@ -0,0 +1,107 @@
+//
+// transpose.hpp
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+
+#ifndef FTL_GFX_TRANSPOSE_HPP
+#define FTL_GFX_TRANSPOSE_HPP
+
+#include <stdint.h>
+
+namespace ftl
+{
+namespace gfx
+{
+
+/**
+ * Transpose an 8x8 bit matrix: bit k of out[i] is bit i of in[k].
+ *
+ * In page layout (a byte per column, LSB at the top) this turns the 8 columns of a tile into its 8 rows. Works on
+ * two 32 bit halves with three rounds of masked swaps instead of 64 single bit moves.
+*/
+inline void transpose8x8(const uint8_t* in, uint8_t* out)
+{
+    uint32_t x = (static_cast<uint32_t>(in[7]) << 24) | (static_cast<uint32_t>(in[6]) << 16)
+               | (static_cast<uint32_t>(in[5]) << 8) | in[4];
+    uint32_t y = (static_cast<uint32_t>(in[3]) << 24) | (static_cast<uint32_t>(in[2]) << 16)
+               | (static_cast<uint32_t>(in[1]) << 8) | in[0];
+    uint32_t t;
+
+    // Swap bits within 2x2, then 4x4 blocks
+    t = (x ^ (x >> 7)) & 0x00AA00AAUL;
+    x = x ^ t ^ (t << 7);
+    t = (y ^ (y >> 7)) & 0x00AA00AAUL;
+    y = y ^ t ^ (t << 7);
+
+    t = (x ^ (x >> 14)) & 0x0000CCCCUL;
+    x = x ^ t ^ (t << 14);
+    t = (y ^ (y >> 14)) & 0x0000CCCCUL;
+    y = y ^ t ^ (t << 14);
+
+    // Swap the 4x4 blocks between the halves
+    t = (x & 0xF0F0F0F0UL) | ((y >> 4) & 0x0F0F0F0FUL);
+    y = ((x << 4) & 0xF0F0F0F0UL) | (y & 0x0F0F0F0FUL);
+    x = t;
+
+    out[0] = static_cast<uint8_t>(y);
+    out[1] = static_cast<uint8_t>(y >> 8);
+    out[2] = static_cast<uint8_t>(y >> 16);
+    out[3] = static_cast<uint8_t>(y >> 24);
+    out[4] = static_cast<uint8_t>(x);
+    out[5] = static_cast<uint8_t>(x >> 8);
+    out[6] = static_cast<uint8_t>(x >> 16);
+    out[7] = static_cast<uint8_t>(x >> 24);
+}
+
+/**
+ * Pages of a page framebuffer with rows and columns swapped.
+ *
+ * Presents a `PAGES * 8` wide, `W` high framebuffer as W columns of PAGES pages, transposing an 8x8 tile at a time
+ * when a page is read. Pages are built in a W byte scratch buffer, so a page pointer is only valid until the next call
+ * to `page()`. Used to send a portrait framebuffer to a landscape panel (see `Ssd1306Display`).
+ *
+ * \tparam W Width of the transposed frame (height of the source framebuffer), a multiple of 8
+ * \tparam PAGES Pages of the transposed frame
+ * \tparam FrameBufferT Source framebuffer (`PageFrameBuffer<PAGES * 8, W / 8>`)
+*/
+template<unsigned int W, unsigned int PAGES, class FrameBufferT>
+class TransposedPages
+{
+    static_assert(W % 8 == 0, "Transposed width must be a multiple of 8");
+
+public:
+    TransposedPages(const FrameBufferT& framebuffer)
+        : framebuffer_(framebuffer)
+    {
+    }
+
+    /**
+     * Transposed page `p`, built from row `p` of 8x8 tiles of the source framebuffer
+    */
+    const uint8_t* page(unsigned int p) const
+    {
+        for (auto tile = 0u; tile < W / 8; ++tile)
+        {
+            // Source page `tile` holds transposed columns [tile * 8, tile * 8 + 8)
+            transpose8x8(framebuffer_.page(tile) + p * 8, scratch_ + tile * 8);
+        }
+
+        return scratch_;
+    }
+
+    static constexpr unsigned int size()
+    {
+        return W * PAGES;
+    }
+
+private:
+    const FrameBufferT& framebuffer_;
+    mutable uint8_t scratch_[W];
+};
+
+}
+}
+
+#endif // FTL_GFX_TRANSPOSE_HPP
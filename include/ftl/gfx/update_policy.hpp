@@ -0,0 +1,225 @@
+//
+// update_policy.hpp
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+
+#ifndef FTL_GFX_UPDATE_POLICY_HPP
+#define FTL_GFX_UPDATE_POLICY_HPP
+
+#include <stdint.h>
+#include <string.h>
+
+#include <ftl/gfx/rect.hpp>
+
+namespace ftl
+{
+namespace gfx
+{
+
+/**
+ * Byte counts for panel updates
+*/
+struct UpdateStats
+{
+    // GDDRAM bytes sent to the panel
+    unsigned long bytes_sent;
+    // GDDRAM bytes skipped because the panel already showed them
+    unsigned long bytes_saved;
+    // Address windows set (one per run of changed bytes)
+    unsigned long windows;
+};
+
+/**
+ * Send the whole page framebuffer on every update.
+ *
+ * Update policies provide `Updater<W, PAGES>`, which sends a `PageFrameBuffer<W, PAGES>` through a page addressed
+ * driver (`setWindow()` and `sendBuffer()`). Frames are read a page at a time with `page(p)`, so any frame providing
+ * W byte pages can be sent (e.g. `TransposedPages`). `update(driver, framebuffer, area)` only sends the pages and columns
+ * covering `area`, which must be inside the framebuffer.
+*/
+struct FullUpdate
+{
+    template<unsigned int W, unsigned int PAGES>
+    class Updater
+    {
+    public:
+        template<class Driver, class FrameBufferT>
+        void update(Driver& driver, const FrameBufferT& framebuffer)
+        {
+            driver.setWindow(0, W - 1, 0, PAGES - 1);
+
+            driver.beginData();
+            for (auto p = 0u; p < PAGES; ++p)
+            {
+                driver.writeData(framebuffer.page(p), W);
+            }
+            driver.endData();
+        }
+
+        template<class Driver, class FrameBufferT>
+        void update(Driver& driver, const FrameBufferT& framebuffer, const Rect& area)
+        {
+            const uint8_t p0 = area.y0 / 8;
+            const uint8_t p1 = area.y1 / 8;
+
+            driver.setWindow(area.x0, area.x1, p0, p1);
+
+            // One window, the page slices are sent in a single transaction
+            driver.beginData();
+            for (auto p = p0; p <= p1; ++p)
+            {
+                driver.writeData(framebuffer.page(p) + area.x0, area.width());
+            }
+            driver.endData();
+        }
+
+        void invalidate()
+        {
+        }
+    };
+};
+
+/**
+ * Keep a shadow copy of the panel's GDDRAM and only send bytes that changed.
+ *
+ * Each page is compared against the shadow and the runs of changed bytes are sent, each with its own address window.
+ * Runs separated by at most GAP unchanged bytes are merged, since resending a few identical bytes is cheaper than
+ * setting another window.
+ *
+ * The shadow costs another framebuffer worth of RAM (1 KB for 128x64, 512 bytes for 128x32).
+ *
+ * \tparam GAP Maximum number of unchanged bytes between two runs that are sent as one
+*/
+template<uint8_t GAP = 8>
+struct DiffUpdate
+{
+    template<unsigned int W, unsigned int PAGES>
+    class Updater
+    {
+    public:
+        Updater()
+            : valid_{false}
+            , stats_{0, 0, 0}
+        {
+        }
+
+        template<class Driver, class FrameBufferT>
+        void update(Driver& driver, const FrameBufferT& framebuffer)
+        {
+            if (!valid_)
+            {
+                // Panel contents are unknown, send everything
+                driver.setWindow(0, W - 1, 0, PAGES - 1);
+
+                driver.beginData();
+                for (auto p = 0u; p < PAGES; ++p)
+                {
+                    const uint8_t* page = framebuffer.page(p);
+                    driver.writeData(page, W);
+                    memcpy(shadow_[p], page, W);
+                }
+                driver.endData();
+
+                stats_.bytes_sent += sizeof(shadow_);
+                stats_.windows++;
+                valid_ = true;
+
+                return;
+            }
+
+            for (auto p = 0u; p < PAGES; ++p)
+            {
+                updatePage(driver, framebuffer.page(p), shadow_[p], p, 0, W - 1);
+            }
+        }
+
+        template<class Driver, class FrameBufferT>
+        void update(Driver& driver, const FrameBufferT& framebuffer, const Rect& area)
+        {
+            if (!valid_)
+            {
+                update(driver, framebuffer);
+                return;
+            }
+
+            for (auto p = area.y0 / 8; p <= area.y1 / 8; ++p)
+            {
+                updatePage(driver, framebuffer.page(p), shadow_[p], p, area.x0, area.x1);
+            }
+        }
+
+        /**
+         * Resend the whole framebuffer on the next update. Call when the panel RAM was changed by other means
+        */
+        void invalidate()
+        {
+            valid_ = false;
+        }
+
+        const UpdateStats& stats() const
+        {
+            return stats_;
+        }
+
+        void resetStats()
+        {
+            stats_ = UpdateStats{0, 0, 0};
+        }
+
+    private:
+        template<class Driver>
+        void updatePage(Driver& driver, const uint8_t* page, uint8_t* shadow, uint8_t p, unsigned int x0,
+                        unsigned int x1)
+        {
+            unsigned int x = x0;
+            unsigned int sent = 0;
+
+            while (x <= x1)
+            {
+                // Find the start of the next changed run
+                while (x <= x1 && page[x] == shadow[x]) ++x;
+                if (x > x1) break;
+
+                const auto start = x;
+                auto end = x;
+
+                // Extend the run while the next change is within GAP bytes
+                while (x <= x1)
+                {
+                    if (page[x] != shadow[x])
+                    {
+                        end = x;
+                    }
+                    else if (x - end > GAP)
+                    {
+                        break;
+                    }
+                    ++x;
+                }
+
+                const auto len = end - start + 1;
+
+                driver.setWindow(start, end, p, p);
+                driver.sendBuffer(page + start, len);
+                memcpy(shadow + start, page + start, len);
+
+                sent += len;
+                stats_.windows++;
+            }
+
+            stats_.bytes_sent += sent;
+            stats_.bytes_saved += x1 - x0 + 1 - sent;
+        }
+
+        uint8_t shadow_[PAGES][W];
+        bool valid_;
+        UpdateStats stats_;
+    };
+};
+
+}
+}
+
+#endif // FTL_GFX_UPDATE_POLICY_HPP
@@ -0,0 +1,413 @@
+//
+// widget.hpp
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+
+#ifndef FTL_GFX_WIDGET_HPP
+#define FTL_GFX_WIDGET_HPP
+
+#include <stdint.h>
+
+#include <ftl/gfx/color.hpp>
+#include <ftl/gfx/display.hpp>
+#include <ftl/gfx/rect.hpp>
+#include <ftl/gfx/sprite.hpp>
+#include <ftl/memory/memreader.hpp>
+
+namespace ftl
+{
+namespace gfx
+{
+
+template<class GfxReader>
+class Screen;
+
+/**
+ * Retained mode UI element.
+ *
+ * A widget owns a fixed rectangle of the screen and keeps the state needed to draw itself. Changing a property
+ * invalidates the part of the widget that changed. `Screen::render()` redraws only invalidated areas. Widgets are
+ * statically allocated by the application and linked into a `Screen`. They must not overlap.
+ *
+ * \tparam GfxReader Method of reading graphics data of the display the widget is drawn on
+*/
+template<class GfxReader = memory::DefaultMemoryReader>
+class Widget
+{
+public:
+    using Display = RasterDisplay<GfxReader>;
+
+    explicit Widget(const Rect& bounds)
+        : bounds_{bounds}
+        , dirty_{bounds}
+        , next_{nullptr}
+    {
+    }
+
+    /**
+     * Draw the widget. The display is clipped to the invalid area, which has already been cleared to black
+    */
+    virtual void draw(Display& display) = 0;
+
+    const Rect& bounds() const
+    {
+        return bounds_;
+    }
+
+    /**
+     * Redraw the whole widget on the next render
+    */
+    void invalidate()
+    {
+        dirty_ = bounds_;
+    }
+
+    /**
+     * Redraw part of the widget on the next render
+    */
+    void invalidate(const Rect& area)
+    {
+        dirty_ = dirty_.unite(bounds_.intersect(area));
+    }
+
+    /**
+     * @return the area that will be redrawn on the next render. Empty if the widget is up to date
+    */
+    const Rect& invalidArea() const
+    {
+        return dirty_;
+    }
+
+protected:
+    ~Widget() = default;
+
+private:
+    friend class Screen<GfxReader>;
+
+    Rect bounds_;
+    Rect dirty_;
+    Widget* next_;
+};
+
+/**
+ * Single line of text. The text is referenced, not copied. Call `setText()` after changing it in place
+*/
+template<class GfxReader = memory::DefaultMemoryReader>
+class Label : public Widget<GfxReader>
+{
+public:
+    Label(const Rect& bounds, const char* text)
+        : Widget<GfxReader>{bounds}
+        , text_{text}
+    {
+    }
+
+    void setText(const char* text)
+    {
+        text_ = text;
+        this->invalidate();
+    }
+
+    const char* text() const
+    {
+        return text_;
+    }
+
+    void draw(typename Widget<GfxReader>::Display& display) override
+    {
+        const auto& b = this->bounds();
+        display.drawString(text_, b.x0, b.y0, Color::white());
+    }
+
+private:
+    const char* text_;
+};
+
+/**
+ * Right aligned integer field of DIGITS 8x8 character cells. Only the cells whose character changes are redrawn.
+ * Values that do not fit are shown as '#'
+*/
+template<uint8_t DIGITS, class GfxReader = memory::DefaultMemoryReader>
+class NumericField : public Widget<GfxReader>
+{
+public:
+    static constexpr uint8_t CELL_SIZE = 8;
+
+    NumericField(int x, int y, int value = 0)
+        : Widget<GfxReader>{Rect{x, y, x + DIGITS * CELL_SIZE - 1, y + CELL_SIZE - 1}}
+        , value_{value}
+    {
+        format(text_, value);
+    }
+
+    void setValue(int value)
+    {
+        if (value == value_) return;
+        value_ = value;
+
+        char text[DIGITS + 1];
+        format(text, value);
+
+        const auto& b = this->bounds();
+
+        for (uint8_t i = 0; i < DIGITS; ++i)
+        {
+            if (text[i] != text_[i])
+            {
+                text_[i] = text[i];
+
+                const int x = b.x0 + i * CELL_SIZE;
+                this->invalidate(Rect{x, b.y0, x + CELL_SIZE - 1, b.y1});
+            }
+        }
+    }
+
+    int value() const
+    {
+        return value_;
+    }
+
+    void draw(typename Widget<GfxReader>::Display& display) override
+    {
+        const auto& b = this->bounds();
+        display.drawString(text_, b.x0, b.y0, Color::white());
+    }
+
+private:
+    static void format(char* text, int value)
+    {
+        const bool negative = value < 0;
+        // Work in unsigned so the most negative value does not overflow
+        unsigned int magnitude = negative ? 0u - static_cast<unsigned int>(value) : static_cast<unsigned int>(value);
+
+        int i = DIGITS - 1;
+        do
+        {
+            text[i--] = '0' + magnitude % 10;
+            magnitude /= 10;
+        }
+        while (magnitude && i >= 0);
+
+        if (negative && i >= 0)
+        {
+            text[i--] = '-';
+        }
+        else if (magnitude || negative)
+        {
+            // Does not fit
+            i = DIGITS - 1;
+            while (i >= 0) text[i--] = '#';
+        }
+
+        // Pad on the left
+        while (i >= 0) text[i--] = ' ';
+
+        text[DIGITS] = '\0';
+    }
+
+    int value_;
+    char text_[DIGITS + 1];
+};
+
+/**
+ * Horizontal bar graph. Only the columns between the old and the new fill level are redrawn on change
+*/
+template<class GfxReader = memory::DefaultMemoryReader>
+class Bar : public Widget<GfxReader>
+{
+public:
+    Bar(const Rect& bounds, int max, int value = 0)
+        : Widget<GfxReader>{bounds}
+        , max_{max > 0 ? max : 1}
+        , value_{0}
+    {
+        value_ = clamp(value);
+    }
+
+    void setValue(int value)
+    {
+        value = clamp(value);
+        if (value == value_) return;
+
+        const auto old_fill = fillWidth(value_);
+        const auto new_fill = fillWidth(value);
+        value_ = value;
+
+        if (old_fill == new_fill) return;
+
+        const auto& b = this->bounds();
+        const int x0 = b.x0 + 1 + (old_fill < new_fill ? old_fill : new_fill);
+        const int x1 = b.x0 + (old_fill > new_fill ? old_fill : new_fill);
+
+        this->invalidate(Rect{x0, b.y0 + 1, x1, b.y1 - 1});
+    }
+
+    int value() const
+    {
+        return value_;
+    }
+
+    void draw(typename Widget<GfxReader>::Display& display) override
+    {
+        const auto& b = this->bounds();
+        display.drawRect(b.x0, b.y0, b.width() - 1, b.height() - 1, Color::white());
+
+        const auto fill = fillWidth(value_);
+        if (fill > 0)
+        {
+            display.drawFillRect(b.x0 + 1, b.y0 + 1, fill - 1, b.height() - 3, Color::white());
+        }
+    }
+
+private:
+    int clamp(int value) const
+    {
+        if (value < 0) return 0;
+        if (value > max_) return max_;
+        return value;
+    }
+
+    /**
+     * Number of filled columns inside the outline
+    */
+    int fillWidth(int value) const
+    {
+        return static_cast<long>(this->bounds().width() - 2) * value / max_;
+    }
+
+    int max_;
+    int value_;
+};
+
+/**
+ * Run length encoded sprite (see `gfx/sprite.hpp`) that can be shown or hidden. Sprites set on an icon must all have
+ * the size of the first one
+*/
+template<class GfxReader = memory::DefaultMemoryReader>
+class Icon : public Widget<GfxReader>
+{
+public:
+    Icon(int x, int y, const uint8_t* sprite)
+        : Widget<GfxReader>{Rect{x, y, x + sprite::width(sprite, GfxReader{}) - 1,
+                                 y + sprite::height(sprite, GfxReader{}) - 1}}
+        , sprite_{sprite}
+        , visible_{true}
+    {
+    }
+
+    void setSprite(const uint8_t* sprite)
+    {
+        if (sprite == sprite_) return;
+        sprite_ = sprite;
+        this->invalidate();
+    }
+
+    void setVisible(bool visible)
+    {
+        if (visible == visible_) return;
+        visible_ = visible;
+        this->invalidate();
+    }
+
+    bool visible() const
+    {
+        return visible_;
+    }
+
+    void draw(typename Widget<GfxReader>::Display& display) override
+    {
+        if (!visible_) return;
+
+        const auto& b = this->bounds();
+        display.drawSprite(sprite_, b.x0, b.y0, Color::white());
+    }
+
+private:
+    const uint8_t* sprite_;
+    bool visible_;
+};
+
+/**
+ * Set of widgets drawn on one display.
+ *
+ * `render()` redraws the invalid area of each widget and passes it to `updateRegion()`, so displays that support
+ * partial updates (`Ssd1306Display`) only send the pages and columns that changed.
+*/
+template<class GfxReader = memory::DefaultMemoryReader>
+class Screen
+{
+public:
+    using Display = RasterDisplay<GfxReader>;
+
+    Screen()
+        : head_{nullptr}
+    {
+    }
+
+    /**
+     * Add a widget. Widgets are linked in place and must outlive the screen
+    */
+    void add(Widget<GfxReader>& widget)
+    {
+        widget.next_ = head_;
+        head_ = &widget;
+        widget.invalidate();
+    }
+
+    /**
+     * Redraw every widget on the next render
+    */
+    void invalidate()
+    {
+        for (auto* w = head_; w; w = w->next_)
+        {
+            w->invalidate();
+        }
+    }
+
+    /**
+     * @return true if any widget needs to be redrawn
+    */
+    bool dirty() const
+    {
+        for (const auto* w = head_; w; w = w->next_)
+        {
+            if (!w->dirty_.empty()) return true;
+        }
+
+        return false;
+    }
+
+    /**
+     * Redraw the invalid areas and update them on the display
+    */
+    void render(Display& display)
+    {
+        for (auto* w = head_; w; w = w->next_)
+        {
+            const auto area = w->dirty_;
+            if (area.empty()) continue;
+
+            // Clip stack is full, leave the widget invalid
+            if (!display.pushClip(area)) continue;
+
+            display.drawFillRect(area.x0, area.y0, area.width() - 1, area.height() - 1, Color::black());
+            w->draw(display);
+
+            display.popClip();
+            display.updateRegion(area);
+
+            w->dirty_ = Rect{0, 0, -1, -1};
+        }
+    }
+
+private:
+    Widget<GfxReader>* head_;
+};
+
+}
+}
+
+#endif // FTL_GFX_WIDGET_HPP
@@ -0,0 +1,40 @@
+//
+// flash.hpp
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+
+#ifndef FTL_MEMORY_FLASH_HPP
+#define FTL_MEMORY_FLASH_HPP
+
+#include <ftl/memory/memreader.hpp>
+
+/**
+ * Place constant tables in program memory on targets where it is a separate address space.
+ *
+ * Data marked with `FTL_FLASH` must be read with `ftl::memory::FlashReader`.
+*/
+#if defined(__AVR__)
+#   include <avr/pgmspace.h>
+#   include <ftl/platform/avr/memory/pgmreader.hpp>
+#   define FTL_FLASH PROGMEM
+#else
+#   define FTL_FLASH
+#endif
+
+namespace ftl
+{
+namespace memory
+{
+
+#if defined(__AVR__)
+using FlashReader = platform::avr::PgmSpaceReader;
+#else
+using FlashReader = DefaultMemoryReader;
+#endif
+
+}
+}
+
+#endif // FTL_MEMORY_FLASH_HPP
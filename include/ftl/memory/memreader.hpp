@@ -9,6 +9,7 @@
 #define FTL_MEMORY_MEMREADER_HPP
 
 #include <stdint.h>
+#include <string.h>
 
 namespace ftl
 {
@@ -18,6 +19,11 @@ namespace memory
 /**
  * Abstract reading memory
  * For example, reading from a pointer or reading from flash memory
+ *
+ * Readers provide:
+ *  - `operator()(ptr, offset)` to read a single byte
+ *  - `read(dst, src, n)` to copy a block into RAM
+ *  - `cursor(ptr, offset)` returning a `Cursor` whose `next()` reads consecutive bytes
 */
 
 /**
@@ -25,10 +31,45 @@ namespace memory
 */
 struct DefaultMemoryReader
 {
+    /**
+     * Sequential reader over RAM
+    */
+    class Cursor
+    {
+    public:
+        explicit Cursor(const uint8_t* ptr)
+            : ptr_{ptr}
+        {
+        }
+
+        uint8_t next()
+        {
+            return *ptr_++;
+        }
+
+        void skip(unsigned int n)
+        {
+            ptr_ += n;
+        }
+
+    private:
+        const uint8_t* ptr_;
+    };
+
     uint8_t operator()(const uint8_t* ptr, unsigned int offset) const
     {
         return ptr[offset];
     }
+
+    void read(uint8_t* dst, const uint8_t* src, unsigned int n) const
+    {
+        memcpy(dst, src, n);
+    }
+
+    Cursor cursor(const uint8_t* ptr, unsigned int offset = 0) const
+    {
+        return Cursor{ptr + offset};
+    }
 };
 
 }
@@ -12,6 +12,7 @@
 #include "uart.hpp"
 
 #include <ftl/platform/avr/interfaces/i2c.hpp>
+#include <ftl/platform/avr/interfaces/spi.hpp>
 #include <ftl/platform/avr/interfaces/timer.hpp>
 
 namespace ftl
@@ -49,6 +50,9 @@ namespace atmega2560
         /* I2C / 2-Wire */
         using I2C0 = HardwareI2C;
 
+        /* SPI */
+        using SPI0 = HardwareSPI;
+
         /* Timers */
         using Timer = AvrTimer;
     };
@@ -12,6 +12,7 @@
 #include "input_capture.hpp"
 
 #include <ftl/platform/avr/interfaces/i2c.hpp>
+#include <ftl/platform/avr/interfaces/spi.hpp>
 #include <ftl/platform/avr/interfaces/timer.hpp>
 
 namespace ftl
@@ -39,6 +40,9 @@ namespace atmega328p
         /* I2C / 2-Wire */
         using I2C0 = HardwareI2C;
 
+        /* SPI */
+        using SPI0 = HardwareSPI;
+
         /* Timer */
         using Timer = AvrTimer;
 
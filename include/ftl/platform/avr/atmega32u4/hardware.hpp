@@ -10,6 +10,7 @@
 
 #include "uart.hpp"
 #include <ftl/platform/avr/interfaces/i2c.hpp>
+#include <ftl/platform/avr/interfaces/spi.hpp>
 #include <ftl/platform/avr/interfaces/timer.hpp>
 
 namespace ftl
@@ -31,6 +32,9 @@ namespace atmega32u4
         /* I2C / 2-wire */
         using I2C0 = HardwareI2C;
 
+        /* SPI */
+        using SPI0 = HardwareSPI;
+
         /* Timers */
         using Timer = AvrTimer;
     };
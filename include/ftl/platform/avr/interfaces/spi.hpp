@@ -0,0 +1,88 @@
+//
+// platform/avr/interfaces/spi.hpp
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+#ifndef FTL_PLATFORM_AVR_SPI_HPP
+#define FTL_PLATFORM_AVR_SPI_HPP
+
+#include <ftl/comms/spi.hpp>
+#include <ftl/platform/avr/support/spi.hpp>
+
+namespace ftl
+{
+namespace platform
+{
+namespace avr
+{
+    /**
+     * Hardware SPI master.
+     *
+     * Chip select is not handled here, see `comms::spi::SpiDevice`.
+    */
+    class HardwareSPI
+    {
+    public:
+        HardwareSPI()
+        {
+        }
+
+        /**
+         * Initialize the SPI interface
+        */
+        static void initialize(comms::spi::ClockDivider divider = comms::spi::ClockDivider::Div2,
+                               comms::spi::Mode mode = comms::spi::Mode::Mode0,
+                               comms::spi::BitOrder order = comms::spi::BitOrder::MsbFirst)
+        {
+            spi::init(divider, mode, order);
+        }
+
+        /**
+         * Exchange a byte on the bus
+        */
+        uint8_t transfer(uint8_t data)
+        {
+            return spi::transfer(data);
+        }
+
+        /**
+         * Write a buffer, blocking until the last byte is sent
+        */
+        void write(const uint8_t* data, unsigned int len)
+        {
+            spi::write(data, len);
+        }
+
+        /**
+         * Write a buffer from the SPI interrupt and return immediately.
+         *
+         * Each byte costs an interrupt, so at the fastest clock dividers a blocking write finishes sooner. Use this to
+         * overlap slow transfers with other work.
+        */
+        void writeAsync(const uint8_t* data, unsigned int len)
+        {
+            spi::writeAsync(data, len);
+        }
+
+        /**
+         * Check if an asynchronous write is in progress
+        */
+        bool busy() const
+        {
+            return spi::busy();
+        }
+
+        /**
+         * Wait for an asynchronous write to complete
+        */
+        void flush()
+        {
+            spi::flush();
+        }
+    };
+}
+}
+} // namespace ftl
+
+#endif // FTL_PLATFORM_AVR_SPI_HPP
@@ -8,6 +8,7 @@
 #define FTL_PLATFORM_AVR_MEMORY_PGMREADER_HPP
 
 #include <avr/pgmspace.h>
+#include <stdint.h>
 
 namespace ftl
 {
@@ -21,10 +22,50 @@ namespace avr
 */
 struct PgmSpaceReader
 {
+    /**
+     * Sequential reader over flash.
+     *
+     * Keeps the address in the Z register pair and reads with a post incrementing `lpm`, so consecutive reads cost no
+     * address arithmetic.
+    */
+    class Cursor
+    {
+    public:
+        explicit Cursor(const uint8_t* ptr)
+            : ptr_{ptr}
+        {
+        }
+
+        uint8_t next()
+        {
+            uint8_t value;
+            asm volatile("lpm %0, Z+" : "=r" (value), "+z" (ptr_));
+            return value;
+        }
+
+        void skip(unsigned int n)
+        {
+            ptr_ += n;
+        }
+
+    private:
+        const uint8_t* ptr_;
+    };
+
     uint8_t operator()(const uint8_t* ptr, unsigned int offset) const
     {
         return pgm_read_byte(ptr + offset);
     }
+
+    void read(uint8_t* dst, const uint8_t* src, unsigned int n) const
+    {
+        memcpy_P(dst, src, n);
+    }
+
+    Cursor cursor(const uint8_t* ptr, unsigned int offset = 0) const
+    {
+        return Cursor{ptr + offset};
+    }
 };
 
 }
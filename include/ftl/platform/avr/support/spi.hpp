@@ -0,0 +1,56 @@
+//
+// spi.hpp
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+
+#ifndef FTL_PLATFORM_AVR_SUPPORT_SPI_HPP
+#define FTL_PLATFORM_AVR_SUPPORT_SPI_HPP
+
+#include <ftl/comms/spi.hpp>
+
+#include <stdint.h>
+
+namespace ftl
+{
+namespace platform
+{
+namespace avr
+{
+namespace spi
+{
+    using ClockDivider = comms::spi::ClockDivider;
+    using Mode = comms::spi::Mode;
+    using BitOrder = comms::spi::BitOrder;
+
+    /**
+     * Initialize SPI in master mode
+    */
+    void init(ClockDivider divider = ClockDivider::Div2, Mode mode = Mode::Mode0, BitOrder order = BitOrder::MsbFirst);
+    /**
+     * Exchange a byte on the bus
+    */
+    uint8_t transfer(uint8_t data);
+    /**
+     * Write a buffer to the bus
+    */
+    void write(const uint8_t* data, uint16_t len);
+    /**
+     * Start an interrupt driven write of a buffer. The buffer must stay valid until the transfer completes
+    */
+    void writeAsync(const uint8_t* data, uint16_t len);
+    /**
+     * Check if an interrupt driven write is in progress
+    */
+    bool busy();
+    /**
+     * Wait for an interrupt driven write to complete
+    */
+    void flush();
+}
+}
+}
+} // namespace ftl
+
+#endif // FTL_PLATFORM_AVR_SUPPORT_SPI_HPP
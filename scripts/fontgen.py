@@ -0,0 +1,241 @@
+# Generate ftl packed proportional fonts (see FontLayout::Packed in include/ftl/gfx/font.hpp)
+#
+# Sources:
+#  - BDF bitmap fonts
+#  - TTF/OTF fonts, rasterised at a pixel size (requires Pillow)
+#  - C headers with 8x8 glyphs in the Rows layout (e.g. include/ftl/gfx/fonts/basic_font.hpp)
+
+import os
+import re
+import sys
+
+from argparse import ArgumentParser
+
+HEADER_SIZE = 4
+RANGE_SIZE = 3
+GLYPH_SIZE = 3
+
+
+def main(args):
+    codes = parse_ranges(args.range)
+    ext = os.path.splitext(args.input)[1].lower()
+
+    if ext == '.bdf':
+        with open(args.input) as f:
+            height, cells = load_bdf(f.read(), codes)
+    elif ext in ('.ttf', '.otf'):
+        if not args.size:
+            raise ValueError('--size is required for TTF/OTF fonts')
+        height, cells = load_ttf(args.input, args.size, codes)
+    else:
+        with open(args.input) as f:
+            height, cells = load_rows_header(f.read(), codes)
+
+    space = args.space if args.space is not None else max(1, height // 3)
+    glyphs = {code: crop(columns, space) for code, columns in cells.items()}
+
+    data = encode(glyphs, height, args.spacing)
+    width = max(len(columns) for columns in glyphs.values())
+
+    name = args.name or re.sub(r'\W', '_', os.path.splitext(os.path.basename(args.input))[0])
+    header = generate_header(name, width, height, data, args.flash)
+
+    if args.output:
+        with open(args.output, 'w') as f:
+            f.write(header)
+    else:
+        print(header)
+
+    print('{}: {} glyphs, {}x{} max, {} bytes ({} bytes as 8x8 tiles)'.format(
+        name, len(glyphs), width, height, len(data), len(glyphs) * 8), file=sys.stderr)
+
+
+def parse_ranges(specs):
+    """Character codes from range specs like '32-126' or '0x41'"""
+    codes = set()
+    for spec in specs or ['32-126']:
+        first, _, last = spec.partition('-')
+        first = int(first, 0)
+        last = int(last, 0) if last else first
+        if not 0 <= first <= last <= 255:
+            raise ValueError('Invalid character range: {}'.format(spec))
+        codes.update(range(first, last + 1))
+
+    return sorted(codes)
+
+
+def load_bdf(text, codes):
+    """Render BDF glyphs into cells of the font height. Columns are ints, bit N is row N"""
+    ascent = int(re.search(r'^FONT_ASCENT\s+(-?\d+)', text, re.M).group(1))
+    descent = int(re.search(r'^FONT_DESCENT\s+(-?\d+)', text, re.M).group(1))
+    height = ascent + descent
+
+    cells = {}
+    for block in re.findall(r'^STARTCHAR.*?^ENDCHAR', text, re.M | re.S):
+        code = int(re.search(r'^ENCODING\s+(-?\d+)', block, re.M).group(1))
+        if code not in codes:
+            continue
+
+        w, h, xoff, yoff = (int(v) for v in re.search(r'^BBX\s+(.*)$', block, re.M).group(1).split())
+        rows = block[block.index('BITMAP') + len('BITMAP'):block.index('ENDCHAR')].split()
+
+        columns = [0] * max(w + max(xoff, 0), 0)
+        top = ascent - (yoff + h)
+        for j, row in enumerate(rows):
+            bits = int(row, 16)
+            nbits = len(row) * 4
+            y = top + j
+            if not 0 <= y < height:
+                continue
+            for i in range(w):
+                if bits & (1 << (nbits - 1 - i)):
+                    columns[max(xoff, 0) + i] |= 1 << y
+
+        cells[code] = columns
+
+    return height, cells
+
+
+def load_ttf(path, size, codes):
+    """Rasterise TTF glyphs with Pillow. Pixels at least half covered are set"""
+    try:
+        from PIL import Image, ImageDraw, ImageFont
+    except ImportError:
+        raise RuntimeError('Pillow is required for TTF/OTF fonts (pip install pillow)')
+
+    font = ImageFont.truetype(path, size)
+    ascent, descent = font.getmetrics()
+    height = ascent + descent
+
+    cells = {}
+    for code in codes:
+        ch = chr(code)
+        w = max(int(font.getlength(ch)) + size, 1)
+
+        image = Image.new('L', (w, height), 0)
+        ImageDraw.Draw(image).text((0, 0), ch, font=font, fill=255)
+
+        columns = [0] * w
+        for x in range(w):
+            for y in range(height):
+                if image.getpixel((x, y)) >= 128:
+                    columns[x] |= 1 << y
+
+        cells[code] = columns
+
+    return height, cells
+
+
+def load_rows_header(text, codes):
+    """8x8 glyphs from the first array in a C header, one byte per row, bit N is column N"""
+    # Comments may contain braces
+    text = re.sub(r'//.*?$|/\*.*?\*/', '', text, flags=re.M | re.S)
+    data = text[text.index('{') + 1:text.index('}')]
+    rows = [int(b, 16) for b in re.findall(r'0x[0-9a-fA-F]+', data)]
+
+    cells = {}
+    for code in codes:
+        glyph = rows[code * 8:code * 8 + 8]
+        if len(glyph) != 8:
+            continue
+
+        cells[code] = [sum(((glyph[y] >> x) & 0x01) << y for y in range(8)) for x in range(8)]
+
+    return 8, cells
+
+
+def crop(columns, space):
+    """Drop the blank columns either side of the glyph. Blank glyphs become `space` columns wide"""
+    ink = [i for i, column in enumerate(columns) if column]
+    if not ink:
+        return [0] * space
+
+    return columns[ink[0]:ink[-1] + 1]
+
+
+def ranges_of(codes):
+    """Group sorted character codes into runs of consecutive codes"""
+    ranges = []
+    for code in codes:
+        if ranges and ranges[-1][1] == code - 1:
+            ranges[-1][1] = code
+        else:
+            ranges.append([code, code])
+
+    return ranges
+
+
+def encode(glyphs, height, spacing):
+    codes = sorted(glyphs)
+    ranges = ranges_of(codes)
+
+    if len(codes) > 256:
+        raise ValueError('Packed fonts are limited to 256 glyphs')
+
+    table = []
+    bits = []
+    for code in codes:
+        columns = glyphs[code]
+        if len(columns) > 255:
+            raise ValueError('Glyph {} is wider than 255 columns'.format(code))
+
+        offset = len(bits)
+        if offset > 0xFFFF:
+            raise ValueError('Glyph bitmap exceeds 64K bits')
+
+        table += [len(columns), offset & 0xFF, offset >> 8]
+        for column in columns:
+            bits += [(column >> y) & 0x01 for y in range(height)]
+
+    bitmap = []
+    for i in range(0, len(bits), 8):
+        bitmap.append(sum(bit << n for n, bit in enumerate(bits[i:i + 8])))
+
+    out = [spacing, len(ranges)]
+    bitmap_offset = HEADER_SIZE + RANGE_SIZE * len(ranges) + GLYPH_SIZE * len(codes)
+    out += [bitmap_offset & 0xFF, bitmap_offset >> 8]
+
+    index = 0
+    for first, last in ranges:
+        if index > 255:
+            raise ValueError('Too many glyphs before range {}-{}'.format(first, last))
+        out += [first, last, index]
+        index += last - first + 1
+
+    return out + table + bitmap
+
+
+def generate_header(name, width, height, data, flash):
+    guard = '{}_FONT_H'.format(name.upper())
+    attribute = ' FTL_FLASH' if flash else ''
+
+    lines = ['#ifndef {}'.format(guard), '#define {}'.format(guard), '', '#include <stdint.h>', '',
+             '#include <ftl/gfx/font.hpp>']
+    if flash:
+        lines.append('#include <ftl/memory/flash.hpp>')
+    lines += ['', 'static const uint8_t {}_font_data[]{} = {{'.format(name, attribute)]
+
+    for i in range(0, len(data), 12):
+        lines.append('    ' + ' '.join('0x{:02x},'.format(b) for b in data[i:i + 12]))
+
+    lines += ['};', '',
+              'static const ftl::gfx::Font {0}_font{{{0}_font_data, ftl::gfx::FontLayout::Packed, {1}, {2}}};'.format(
+                  name, width, height),
+              '', '#endif', '']
+
+    return '\n'.join(lines)
+
+
+if __name__ == '__main__':
+    parser = ArgumentParser(description='Generate an ftl packed proportional font')
+    parser.add_argument('input', help='BDF, TTF/OTF, or C header with 8x8 glyphs in the Rows layout')
+    parser.add_argument('-o', '--output', help='Output header. Printed to stdout if not set')
+    parser.add_argument('-n', '--name', help='Font name. Defaults to the input file name')
+    parser.add_argument('-r', '--range', action='append',
+                        help='Character range to include, e.g. 32-126 (default) or 0x41. May be repeated')
+    parser.add_argument('-s', '--size', type=int, help='Pixel size to rasterise TTF/OTF fonts at')
+    parser.add_argument('--spacing', type=int, default=1, help='Blank columns drawn after each glyph')
+    parser.add_argument('--space', type=int, help='Width of blank glyphs such as space. Defaults to a third of the height')
+    parser.add_argument('--flash', action='store_true', help='Place the font in flash (read with FlashReader)')
+
+    main(parser.parse_args())
@@ -0,0 +1,174 @@
+# Run the graphics benchmark (examples/avr/gfx_benchmark) and collect its results as CSV
+#
+# Targets:
+#  - host: build the benchmark with the host compiler and run it. Times are nanoseconds
+#  - simavr: run ATmega328p images under simavr. Times are CPU cycles
+#
+# Results can be compared against a baseline CSV. Rows that got slower or send more bytes than the threshold allows,
+# and primitives whose static and virtual renders differ, are reported and fail the run.
+
+import csv
+import os
+import subprocess
+import sys
+import tempfile
+import threading
+
+from argparse import ArgumentParser
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+SOURCE = os.path.join(ROOT, 'examples', 'avr', 'gfx_benchmark', 'main.cpp')
+
+FIELDS = ['platform', 'primitive', 'dispatch', 'time', 'fb_bytes', 'bus_bytes', 'checksum']
+
+
+def main(args):
+    if args.target == 'host':
+        lines = run_host(args.cxx, args.timeout)
+    else:
+        if not args.elf:
+            raise ValueError('simavr requires at least one --elf image')
+        lines = []
+        for elf in args.elf:
+            lines += run_simavr(args.simavr, elf, args.mcu, args.freq, args.timeout)
+
+    results = parse(lines)
+    if not results:
+        raise RuntimeError('No benchmark results in the output')
+
+    if args.output:
+        with open(args.output, 'w', newline='') as f:
+            write_csv(f, results)
+    else:
+        write_csv(sys.stdout, results)
+
+    errors = check_dispatch(results)
+    if args.compare:
+        with open(args.compare, newline='') as f:
+            baseline = list(csv.DictReader(f))
+        errors += compare(baseline, results, args.threshold)
+
+    for error in errors:
+        print(error, file=sys.stderr)
+
+    return 1 if errors else 0
+
+
+def run_host(cxx, timeout):
+    with tempfile.TemporaryDirectory() as tmp:
+        exe = os.path.join(tmp, 'gfx_benchmark')
+        subprocess.run([cxx, '-std=c++14', '-O2', '-I' + os.path.join(ROOT, 'include'), SOURCE, '-o', exe],
+                       check=True)
+        out = subprocess.run([exe], check=True, stdout=subprocess.PIPE, universal_newlines=True, timeout=timeout)
+
+    return out.stdout.splitlines()
+
+
+def run_simavr(simavr, elf, mcu, freq, timeout):
+    """Run an image until it reports bench_done. simavr does not exit on its own"""
+    proc = subprocess.Popen([simavr, '-m', mcu, '-f', str(freq), elf], stdout=subprocess.PIPE,
+                            stderr=subprocess.STDOUT, universal_newlines=True)
+    lines = []
+    try:
+        timer = threading.Timer(timeout, proc.kill)
+        timer.start()
+        for line in proc.stdout:
+            lines.append(line)
+            if 'bench_done' in line:
+                break
+        timer.cancel()
+    finally:
+        proc.kill()
+        proc.wait()
+
+    if not any('bench_done' in line for line in lines):
+        raise RuntimeError('{} did not finish within {} seconds'.format(elf, timeout))
+
+    return lines
+
+
+def parse(lines):
+    """Result rows from benchmark output. Log prefixes and the header lines are skipped"""
+    results = []
+    for line in lines:
+        if 'bench,' not in line:
+            continue
+
+        values = line[line.index('bench,'):].strip().split(',')[1:]
+        if len(values) != len(FIELDS) or values[0] == 'platform':
+            continue
+
+        row = dict(zip(FIELDS, values))
+        for field in ('time', 'fb_bytes', 'bus_bytes'):
+            row[field] = int(row[field])
+        results.append(row)
+
+    return results
+
+
+def write_csv(f, results):
+    writer = csv.DictWriter(f, fieldnames=FIELDS, lineterminator='\n')
+    writer.writeheader()
+    writer.writerows(results)
+
+
+def key(row):
+    return row['platform'], row['primitive'], row['dispatch']
+
+
+def check_dispatch(results):
+    """Static and virtual renders of a primitive must be identical"""
+    checksums = {}
+    for row in results:
+        checksums.setdefault((row['platform'], row['primitive']), {})[row['dispatch']] = row['checksum']
+
+    errors = []
+    for (platform, primitive), by_dispatch in sorted(checksums.items()):
+        if len(set(by_dispatch.values())) > 1:
+            errors.append('{} {}: static and virtual renders differ ({})'.format(
+                platform, primitive, ', '.join('{}={}'.format(d, c) for d, c in sorted(by_dispatch.items()))))
+
+    return errors
+
+
+def compare(baseline, results, threshold):
+    """Rows slower, or touching or sending more bytes, than the baseline by more than threshold percent"""
+    base = {key(row): row for row in baseline}
+
+    errors = []
+    for row in results:
+        old = base.get(key(row))
+        if old is None:
+            continue
+
+        for field in ('time', 'fb_bytes', 'bus_bytes'):
+            before = int(old[field])
+            after = row[field]
+            if after > before * (1 + threshold / 100.0) and after - before > 1:
+                errors.append('{} {} {}: {} {} -> {} ({:+.1f}%)'.format(
+                    row['platform'], row['primitive'], row['dispatch'], field, before, after,
+                    100.0 * (after - before) / max(before, 1)))
+
+        if row['checksum'] != old['checksum']:
+            errors.append('{} {} {}: render changed (checksum {} -> {})'.format(
+                row['platform'], row['primitive'], row['dispatch'], old['checksum'], row['checksum']))
+
+    return errors
+
+
+if __name__ == '__main__':
+    parser = ArgumentParser(description='Run the ftl graphics benchmark and compare against a baseline')
+    parser.add_argument('target', choices=['host', 'simavr'], help='Where to run the benchmark')
+    parser.add_argument('-e', '--elf', action='append',
+                        help='ATmega328p benchmark image to run under simavr. May be repeated (one per suite)')
+    parser.add_argument('-o', '--output', help='Output CSV. Printed to stdout if not set')
+    parser.add_argument('-c', '--compare', help='Baseline CSV to compare against')
+    parser.add_argument('-t', '--threshold', type=float, default=5.0,
+                        help='Allowed increase over the baseline in percent (default 5)')
+    parser.add_argument('--cxx', default=os.environ.get('CXX', 'c++'), help='Host C++ compiler')
+    parser.add_argument('--simavr', default='simavr', help='simavr executable')
+    parser.add_argument('--mcu', default='atmega328p', help='simavr MCU')
+    parser.add_argument('--freq', type=int, default=16000000, help='simavr CPU frequency')
+    parser.add_argument('--timeout', type=int, default=120, help='Seconds to wait for each run')
+
+    sys.exit(main(parser.parse_args()))
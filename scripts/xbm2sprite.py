@@ -0,0 +1,157 @@
+# Convert XBM images to ftl run length encoded sprites (see include/ftl/gfx/sprite.hpp)
+#
+# Several images are combined into an animation frame set, one frame per image in the given order.
+
+import os
+import sys
+import re
+
+from argparse import ArgumentParser
+
+RUN_SKIP = 0x00
+RUN_REPEAT = 0x40
+RUN_LITERAL = 0x80
+MAX_RUN = 64
+
+
+def main(args):
+    images = []
+    for path in args.input:
+        with open(path) as f:
+            images.append(parse_xbm(f.read()))
+
+    name = args.name or os.path.splitext(os.path.basename(args.input[0]))[0]
+    sprites = [encode(width, height, bits) for width, height, bits in images]
+    width = max(image[0] for image in images)
+    height = max(image[1] for image in images)
+
+    if len(sprites) == 1:
+        header = generate_header(name, width, height, sprites[0], args.flash)
+        data = sprites[0]
+    else:
+        data = encode_frames(sprites)
+        header = generate_header(name, width, height, data, args.flash, suffix='frames')
+
+    if args.output:
+        with open(args.output, 'w') as f:
+            f.write(header)
+    else:
+        print(header)
+
+    xbm_size = sum(((w + 7) // 8) * h for w, h, _ in images)
+    print('{}: {} frame(s), {}x{}, XBM {} bytes, sprite {} bytes'.format(name, len(sprites), width, height, xbm_size,
+                                                                       len(data)), file=sys.stderr)
+
+
+def parse_xbm(text):
+    width = int(re.search(r'#define\s+\w*_width\s+(\d+)', text).group(1))
+    height = int(re.search(r'#define\s+\w*_height\s+(\d+)', text).group(1))
+    data = text[text.index('{') + 1:text.index('}')]
+    bits = [int(b, 16) for b in re.findall(r'0x[0-9a-fA-F]+', data)]
+
+    return width, height, bits
+
+
+def pixel(width, bits, x, y):
+    bytes_per_row = (width + 7) // 8
+    return (bits[y * bytes_per_row + x // 8] >> (x % 8)) & 0x01
+
+
+def page_columns(width, height, bits, page_row):
+    """Column bytes of a page row, LSB at the top"""
+    columns = []
+    for x in range(width):
+        column = 0
+        for i in range(8):
+            y = page_row * 8 + i
+            if y < height and pixel(width, bits, x, y):
+                column |= 1 << i
+        columns.append(column)
+    return columns
+
+
+def encode_runs(columns):
+    out = []
+    i = 0
+
+    while i < len(columns):
+        # Length of the run of identical bytes starting here
+        n = 1
+        while i + n < len(columns) and columns[i + n] == columns[i] and n < MAX_RUN:
+            n += 1
+
+        if columns[i] == 0:
+            out.append(RUN_SKIP | (n - 1))
+            i += n
+        elif n >= 3:
+            out += [RUN_REPEAT | (n - 1), columns[i]]
+            i += n
+        else:
+            # Literal run until the next transparent or repeated section
+            start = i
+            while i < len(columns) and i - start < MAX_RUN and columns[i] != 0:
+                if i + 2 < len(columns) and columns[i] == columns[i + 1] == columns[i + 2]:
+                    break
+                i += 1
+            out += [RUN_LITERAL | (i - start - 1)] + columns[start:i]
+
+    return out
+
+
+def encode(width, height, bits):
+    if width > 255 or height > 255:
+        raise ValueError('Sprites are limited to 255x255 pixels')
+
+    sprite = [width, height]
+    for page_row in range((height + 7) // 8):
+        sprite += encode_runs(page_columns(width, height, bits, page_row))
+
+    return sprite
+
+
+def encode_frames(sprites):
+    """Frame set: frame count, 16 bit offset of each frame, then the frames"""
+    if len(sprites) > 255:
+        raise ValueError('Frame sets are limited to 255 frames')
+
+    out = [len(sprites)]
+    offset = 1 + 2 * len(sprites)
+    for sprite in sprites:
+        if offset > 0xFFFF:
+            raise ValueError('Frame set exceeds 64 KB')
+        out += [offset & 0xFF, offset >> 8]
+        offset += len(sprite)
+
+    for sprite in sprites:
+        out += sprite
+
+    return out
+
+
+def generate_header(name, width, height, sprite, flash, suffix='sprite'):
+    guard = '{}_{}_H'.format(name.upper(), suffix.upper())
+    attribute = ' FTL_FLASH' if flash else ''
+
+    lines = ['#ifndef {}'.format(guard), '#define {}'.format(guard), '', '#include <stdint.h>']
+    if flash:
+        lines.append('#include <ftl/memory/flash.hpp>')
+    lines += ['', '#define {}_{}_width {}'.format(name, suffix, width),
+              '#define {}_{}_height {}'.format(name, suffix, height), '']
+    lines.append('static const uint8_t {}_{}[]{} = {{'.format(name, suffix, attribute))
+
+    for i in range(0, len(sprite), 12):
+        lines.append('    ' + ' '.join('0x{:02x},'.format(b) for b in sprite[i:i + 12]))
+
+    lines += ['};', '', '#endif', '']
+
+    return '\n'.join(lines)
+
+
+if __name__ == '__main__':
+    parser = ArgumentParser(description='Convert XBM images to an ftl sprite or animation frame set')
+    parser.add_argument('input', nargs='+', help='XBM file. Several files make a frame set, one frame per file')
+    parser.add_argument('-o', '--output', help='Output header. Printed to stdout if not set')
+    parser.add_argument('-n', '--name', help='Sprite name. Defaults to the input file name')
+    parser.add_argument('--flash', action='store_true', help='Place the sprite in flash (read with FlashReader)')
+
+    main(parser.parse_args())
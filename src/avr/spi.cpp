@@ -0,0 +1,139 @@
+//
+// spi.cpp
+//
+// @brief AVR SPI support library
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+
+#include <ftl/platform/avr/support/spi.hpp>
+#include <ftl/utils/bitutil.hpp>
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+
+// SPI pins
+#if defined(__AVR_ATmega328P__)
+#   define SPI_DDR  DDRB
+#   define SPI_SS   PB2
+#   define SPI_MOSI PB3
+#   define SPI_SCK  PB5
+#elif defined(__AVR_ATmega2560__) || defined(__AVR_ATmega32U4__)
+#   define SPI_DDR  DDRB
+#   define SPI_SS   PB0
+#   define SPI_SCK  PB1
+#   define SPI_MOSI PB2
+#else
+#   error "SPI pins not defined for this device"
+#endif
+
+// Wait for the current byte to be shifted out
+#define SPI_WAIT() while(!(SPSR & BV(SPIF)))
+
+// Remaining bytes of an interrupt driven write
+static const uint8_t* volatile tx_data = nullptr;
+static volatile uint16_t tx_remaining = 0;
+static volatile bool tx_busy = false;
+
+namespace ftl
+{
+namespace platform
+{
+namespace avr
+{
+namespace spi
+{
+    void init(ClockDivider divider, Mode mode, BitOrder order)
+    {
+        // SS must be an output in master mode, otherwise pulling it low switches the interface to slave mode
+        SPI_DDR |= BV(SPI_SS) | BV(SPI_MOSI) | BV(SPI_SCK);
+
+        // SPR1:0 and SPI2X for each divider
+        static const uint8_t spr[] = {0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x03};
+        static const bool spi2x[] = {true, false, true, false, true, false, false};
+        const auto d = static_cast<uint8_t>(divider);
+
+        SPCR = BV(SPE) | BV(MSTR)
+             | ((order == BitOrder::LsbFirst) ? BV(DORD) : 0)
+             | (static_cast<uint8_t>(mode) << CPHA)
+             | spr[d];
+
+        if (spi2x[d])
+        {
+            SET_BIT(SPSR, SPI2X);
+        }
+        else
+        {
+            CLR_BIT(SPSR, SPI2X);
+        }
+    }
+
+    uint8_t transfer(uint8_t data)
+    {
+        flush();
+
+        SPDR = data;
+        SPI_WAIT();
+
+        return SPDR;
+    }
+
+    void write(const uint8_t* data, uint16_t len)
+    {
+        flush();
+
+        // Reading SPSR with SPIF set, then writing SPDR, clears SPIF
+        while (len--)
+        {
+            SPDR = *data++;
+            SPI_WAIT();
+        }
+    }
+
+    void writeAsync(const uint8_t* data, uint16_t len)
+    {
+        if (len == 0) return;
+
+        flush();
+
+        tx_data = data + 1;
+        tx_remaining = len - 1;
+        tx_busy = true;
+
+        // A blocking transfer leaves SPIF set. Clear it so enabling the interrupt does not fire before the first byte
+        // is loaded, which would collide with the write below
+        (void)SPSR;
+        (void)SPDR;
+
+        SPDR = data[0];
+        SET_BIT(SPCR, SPIE);
+    }
+
+    bool busy()
+    {
+        return tx_busy;
+    }
+
+    void flush()
+    {
+        while (tx_busy);
+    }
+}
+}
+}
+} // namespace ftl
+
+// Transfer complete. Send the next byte of an asynchronous write
+ISR(SPI_STC_vect)
+{
+    if (tx_remaining)
+    {
+        SPDR = *tx_data++;
+        tx_remaining--;
+    }
+    else
+    {
+        CLR_BIT(SPCR, SPIE);
+        tx_busy = false;
+    }
+}
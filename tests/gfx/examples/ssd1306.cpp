@@ -0,0 +1,62 @@
+//
+// ssd1306.cpp
+//
+// Screen of examples/avr/ssd1306
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+
+#include "../host_panel.hpp"
+#include "../render_test.hpp"
+
+#include <ftl/drivers/displays/ssd1306.hpp>
+#include <ftl/gfx/adaptors/ssd1306_display.hpp>
+#include <ftl/gfx/fonts/basic_prop_font.hpp>
+#include <ftl/memory/flash.hpp>
+
+#include "../../../examples/avr/ssd1306/dino_sprite.h"
+
+#define OLED_ADDRESS 0x3C
+
+using namespace ftl::drivers;
+using namespace ftl::tests;
+
+namespace
+{
+
+void screen(Frame& frame)
+{
+    HostPanel::resetAll();
+
+    ftl::gfx::Ssd1306Display<HostPanelTransport, ftl::memory::FlashReader> display{OLED_ADDRESS};
+    display.initialize();
+
+    display.clear();
+    display.drawSprite(dino_sprite, 0, 20, ftl::gfx::Color::white());
+    display.setFont(&ftl::gfx::fonts::BASIC_PROP_FLASH_FONT);
+    display.drawString("Proportional text", 0, 0, ftl::gfx::Color::white());
+    display.update();
+
+    // Scrolling is done by the panel and does not change GDDRAM
+    auto& driver = display.getDriver();
+    driver.setupHorizontalScroll(Ssd1306_ScrollDirection::Right, 0, 7, Ssd1306_FrameInterval::FRAME_2);
+    driver.scroll(true);
+
+    HostPanel::get(OLED_ADDRESS).copyTo(frame);
+}
+
+}
+
+namespace ftl
+{
+namespace tests
+{
+
+const Scene SSD1306_SCENES[] = {
+    {"ssd1306", nullptr, screen},
+    {nullptr, nullptr, nullptr},
+};
+
+}
+}
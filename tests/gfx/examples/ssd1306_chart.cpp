@@ -0,0 +1,84 @@
+//
+// ssd1306_chart.cpp
+//
+// Screen of examples/avr/ssd1306_chart, with a generated temperature series in place of the MCP9600
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+
+#include <stdio.h>
+
+#include "../host_panel.hpp"
+#include "../render_test.hpp"
+
+#include <ftl/drivers/displays/ssd1306.hpp>
+#include <ftl/gfx/strip_chart.hpp>
+#include <ftl/gfx/text_console.hpp>
+#include <ftl/gfx/fonts/basic_font.hpp>
+#include <ftl/memory/flash.hpp>
+
+#define OLED_ADDRESS 0x3C
+
+using namespace ftl::drivers;
+using namespace ftl::gfx;
+using namespace ftl::tests;
+
+namespace
+{
+
+using Driver = Ssd1306<HostPanelTransport>;
+
+/**
+ * Triangle wave with a step, sampled past the chart width so the chart wraps
+*/
+int temperature(int i)
+{
+    const int t = i % 90;
+    return ((t < 45) ? 20 + t : 110 - t) + ((i / 30) % 2) * 15;
+}
+
+void screen(Frame& frame)
+{
+    HostPanel::resetAll();
+
+    Driver driver{OLED_ADDRESS};
+    driver.initialize();
+
+    TextConsole<Driver, 16, 1, ftl::memory::FlashReader> header{driver, &fonts::BASIC_PAGE_FONT};
+    header.initialize();
+
+    StripChart<Driver, 7> chart{driver, 0, Driver::WIDTH, 1};
+    chart.setRange(0, 100);
+    chart.clear();
+
+    char buf[17];
+
+    for (int i = 0; i < 200; ++i)
+    {
+        const auto hot = temperature(i);
+
+        snprintf(buf, sizeof(buf), "temp: %4d C", hot);
+        header.print(0, 0, buf);
+        header.flush();
+
+        chart.plot(hot);
+    }
+
+    HostPanel::get(OLED_ADDRESS).copyTo(frame);
+}
+
+}
+
+namespace ftl
+{
+namespace tests
+{
+
+const Scene SSD1306_CHART_SCENES[] = {
+    {"ssd1306_chart", nullptr, screen},
+    {nullptr, nullptr, nullptr},
+};
+
+}
+}
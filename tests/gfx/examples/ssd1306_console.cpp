@@ -0,0 +1,78 @@
+//
+// ssd1306_console.cpp
+//
+// Screen of examples/avr/ssd1306_console
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+
+#include <stdio.h>
+
+#include "../host_panel.hpp"
+#include "../render_test.hpp"
+
+#include <ftl/drivers/displays/ssd1306.hpp>
+#include <ftl/gfx/text_console.hpp>
+#include <ftl/gfx/fonts/basic_font.hpp>
+#include <ftl/memory/flash.hpp>
+
+#define OLED_ADDRESS 0x3C
+
+using namespace ftl::drivers;
+using namespace ftl::gfx;
+using namespace ftl::tests;
+
+namespace
+{
+
+using Driver = Ssd1306<HostPanelTransport>;
+using Console = TextConsole<Driver, 16, 8, ftl::memory::FlashReader>;
+
+/**
+ * The dashboard after some updates, each flushing only the changed digits
+*/
+void screen(Frame& frame)
+{
+    HostPanel::resetAll();
+
+    Driver driver{OLED_ADDRESS};
+    driver.initialize();
+
+    Console console{driver, &fonts::BASIC_PAGE_FONT};
+    console.initialize();
+
+    console.print(0, 0, "   FTL CONSOLE  ", Console::ATTR_INVERSE);
+    console.print(0, 2, "count:");
+    console.print(0, 3, "uptime:");
+
+    char buf[Console::NUM_COLS + 1];
+
+    for (unsigned int count = 0; count <= 1234; ++count)
+    {
+        snprintf(buf, sizeof(buf), "%5u", count);
+        console.print(8, 2, buf);
+
+        snprintf(buf, sizeof(buf), "%5us", count / 10);
+        console.print(8, 3, buf);
+
+        console.flush();
+    }
+
+    HostPanel::get(OLED_ADDRESS).copyTo(frame);
+}
+
+}
+
+namespace ftl
+{
+namespace tests
+{
+
+const Scene SSD1306_CONSOLE_SCENES[] = {
+    {"ssd1306_console", nullptr, screen},
+    {nullptr, nullptr, nullptr},
+};
+
+}
+}
@@ -0,0 +1,91 @@
+//
+// ssd1306_dual.cpp
+//
+// Screens of examples/avr/ssd1306_dual
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+
+#include <stdio.h>
+
+#include "../host_panel.hpp"
+#include "../render_test.hpp"
+
+#include <ftl/gfx/adaptors/ssd1306_panel_group.hpp>
+#include <ftl/gfx/fonts/basic_prop_font.hpp>
+
+#define LEFT_ADDRESS 0x3C
+#define RIGHT_ADDRESS 0x3D
+
+using namespace ftl::gfx;
+using namespace ftl::tests;
+
+namespace
+{
+
+using Panel = Ssd1306StreamPanel<HostPanelTransport>;
+
+/**
+ * Render both panels for a few frames and copy one of them
+*/
+void run(Frame& frame, uint8_t address)
+{
+    HostPanel::resetAll();
+
+    Panel::PageBuffer page;
+    Panel left{page, LEFT_ADDRESS};
+    Panel right{page, RIGHT_ADDRESS};
+
+    Ssd1306PanelGroup<Panel, 2> panels{left, right};
+    panels.initialize();
+
+    left.setFont(&fonts::BASIC_PROP_FONT);
+    right.setFont(&fonts::BASIC_PROP_FONT);
+
+    char count_str[8];
+
+    for (unsigned int count = 0; count <= 77; ++count)
+    {
+        snprintf(count_str, sizeof(count_str), "%u", count);
+
+        left.clear();
+        left.drawString("Left panel", 0, 0, Color::white());
+        left.drawScaledString(count_str, 0, 24, 3, Color::white());
+
+        right.clear();
+        right.drawString("Right panel", 0, 0, Color::white());
+        right.drawFillRect(0, 24, count % 128, 16, Color::white());
+        right.drawRect(0, 24, 127, 16, Color::white());
+
+        panels.update();
+    }
+
+    HostPanel::get(address).copyTo(frame);
+}
+
+void leftPanel(Frame& frame)
+{
+    run(frame, LEFT_ADDRESS);
+}
+
+void rightPanel(Frame& frame)
+{
+    run(frame, RIGHT_ADDRESS);
+}
+
+}
+
+namespace ftl
+{
+namespace tests
+{
+
+const Scene SSD1306_DUAL_SCENES[] = {
+    {"ssd1306_dual_left", nullptr, leftPanel},
+    {"ssd1306_dual_right", nullptr, rightPanel},
+    {nullptr, nullptr, nullptr},
+};
+
+}
+}
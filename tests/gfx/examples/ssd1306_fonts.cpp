@@ -0,0 +1,63 @@
+//
+// ssd1306_fonts.cpp
+//
+// Screen of examples/avr/ssd1306_fonts
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+
+#include "../host_panel.hpp"
+#include "../render_test.hpp"
+
+#include <ftl/gfx/adaptors/ssd1306_display.hpp>
+#include <ftl/logging/logger.hpp>
+#include <ftl/logging/adaptors/display_adaptor.hpp>
+#include <ftl/gfx/fonts/basic_font.hpp>
+#include <ftl/memory/flash.hpp>
+
+#define OLED_ADDRESS 0x3C
+
+using namespace ftl::logging;
+using namespace ftl::tests;
+
+namespace
+{
+
+/**
+ * Enough log lines to wrap around to the top of the panel
+*/
+void screen(Frame& frame)
+{
+    HostPanel::resetAll();
+
+    Logger<RasterDisplayLoggerAdaptor<ftl::gfx::Ssd1306Display<HostPanelTransport, ftl::memory::FlashReader>>> logger{
+        OLED_ADDRESS};
+    logger.getOutput().getDisplay().setFont(&ftl::gfx::fonts::BASIC_PAGE_FONT);
+
+    SystemLogger::instance().setLogger(&logger);
+
+    for (int count = 0; count < 11; ++count)
+    {
+        LOG_INFO("count: %d", count);
+    }
+
+    SystemLogger::instance().setLogger(&NoopLogger::instance());
+
+    HostPanel::get(OLED_ADDRESS).copyTo(frame);
+}
+
+}
+
+namespace ftl
+{
+namespace tests
+{
+
+const Scene SSD1306_FONTS_SCENES[] = {
+    {"ssd1306_fonts", nullptr, screen},
+    {nullptr, nullptr, nullptr},
+};
+
+}
+}
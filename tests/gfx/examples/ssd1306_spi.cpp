@@ -0,0 +1,60 @@
+//
+// ssd1306_spi.cpp
+//
+// Screen of examples/avr/ssd1306_spi
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+
+#include "../host_panel.hpp"
+#include "../render_test.hpp"
+
+#include <ftl/gfx/adaptors/ssd1306_display.hpp>
+#include <ftl/memory/flash.hpp>
+
+#include "../../../examples/avr/ssd1306_spi/dino_sprite.h"
+
+using namespace ftl::tests;
+
+namespace
+{
+
+/**
+ * The sixth frame of the scrolling sprite
+*/
+void screen(Frame& frame)
+{
+    HostPanel::resetAll();
+
+    ftl::gfx::Ssd1306Display<HostPanelTransport, ftl::memory::FlashReader> display;
+    display.initialize();
+
+    int x = 0;
+
+    for (auto i = 0u; i < 6; ++i)
+    {
+        display.clear();
+        display.drawSprite(dino_sprite, x, 20, ftl::gfx::Color::white());
+        display.update();
+
+        x = (x + 4) % (display.width() - dino_sprite_width);
+    }
+
+    HostPanel::get(0x3C).copyTo(frame);
+}
+
+}
+
+namespace ftl
+{
+namespace tests
+{
+
+const Scene SSD1306_SPI_SCENES[] = {
+    {"ssd1306_spi", nullptr, screen},
+    {nullptr, nullptr, nullptr},
+};
+
+}
+}
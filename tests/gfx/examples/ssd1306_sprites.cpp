@@ -0,0 +1,112 @@
+//
+// ssd1306_sprites.cpp
+//
+// Screens of examples/avr/ssd1306_sprites
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+
+#include "../host_panel.hpp"
+#include "../render_test.hpp"
+
+#include <ftl/gfx/adaptors/ssd1306_display.hpp>
+#include <ftl/gfx/sprite_layer.hpp>
+#include <ftl/memory/flash.hpp>
+
+#include "../../../examples/avr/ssd1306_sprites/ball_frames.h"
+#include "../../../examples/avr/ssd1306_sprites/dino_sprite.h"
+
+#define OLED_ADDRESS 0x3C
+
+using namespace ftl::gfx;
+using namespace ftl::tests;
+
+namespace
+{
+
+using Reader = ftl::memory::FlashReader;
+using Display = Ssd1306Display<HostPanelTransport, Reader>;
+
+void bounce(AnimatedSprite<Reader>& s, const Display& display)
+{
+    const int max_x = static_cast<int>(display.width()) - ball_frames_width;
+    const int max_y = static_cast<int>(display.height()) - ball_frames_height;
+
+    const int vx = (s.x() <= 0 && s.vx() < 0) || (s.x() >= max_x && s.vx() > 0) ? -s.vx() : s.vx();
+    const int vy = (s.y() <= 0 && s.vy() < 0) || (s.y() >= max_y && s.vy() > 0) ? -s.vy() : s.vy();
+
+    s.setVelocity(vx, vy);
+}
+
+/**
+ * Run the example for a number of steps
+*/
+void run(Frame& frame, unsigned int steps)
+{
+    HostPanel::resetAll();
+
+    Display display{OLED_ADDRESS};
+    display.initialize();
+
+    SpriteLayer<Reader> layer{dino_sprite};
+
+    AnimatedSprite<Reader> balls[] = {
+        {ball_frames, 0, 0, 4},
+        {ball_frames, 60, 40, 6},
+        {ball_frames, 100, 10, 3},
+    };
+    balls[0].setVelocity(24, 12);
+    balls[1].setVelocity(-18, 20);
+    balls[2].setVelocity(10, -28);
+
+    for (auto& ball : balls)
+    {
+        layer.add(ball);
+    }
+
+    layer.redraw(display);
+    display.update();
+
+    for (auto i = 0u; i < steps; ++i)
+    {
+        for (auto& ball : balls)
+        {
+            bounce(ball, display);
+        }
+
+        layer.step();
+        layer.render(display);
+    }
+
+    HostPanel::get(OLED_ADDRESS).copyTo(frame);
+}
+
+void start(Frame& frame)
+{
+    run(frame, 0);
+}
+
+/**
+ * Long enough for every ball to have bounced off an edge, sent as partial updates only
+*/
+void moved(Frame& frame)
+{
+    run(frame, 150);
+}
+
+}
+
+namespace ftl
+{
+namespace tests
+{
+
+const Scene SSD1306_SPRITES_SCENES[] = {
+    {"ssd1306_sprites_start", nullptr, start},
+    {"ssd1306_sprites_moved", nullptr, moved},
+    {nullptr, nullptr, nullptr},
+};
+
+}
+}
@@ -0,0 +1,85 @@
+//
+// ssd1306_widgets.cpp
+//
+// Screen of examples/avr/ssd1306_widgets
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+
+#include "../host_panel.hpp"
+#include "../render_test.hpp"
+
+#include <ftl/gfx/adaptors/ssd1306_display.hpp>
+#include <ftl/gfx/adaptors/virtual_display.hpp>
+#include <ftl/gfx/widget.hpp>
+#include <ftl/gfx/fonts/basic_font.hpp>
+#include <ftl/memory/flash.hpp>
+
+#define OLED_ADDRESS 0x3C
+
+using namespace ftl::gfx;
+using namespace ftl::tests;
+
+namespace
+{
+
+// 8x8 heart, a single literal run per page row
+const uint8_t heart_sprite[] FTL_FLASH = {
+    8, 8,
+    0x87, 0x0C, 0x1E, 0x3E, 0x7C, 0x7C, 0x3E, 0x1E, 0x0C,
+};
+
+using Reader = ftl::memory::FlashReader;
+using Display = Ssd1306Display<HostPanelTransport, Reader>;
+
+/**
+ * Every frame up to a count, so only the changes of each render reach the panel
+*/
+void dashboard(Frame& frame)
+{
+    HostPanel::resetAll();
+
+    Display oled{OLED_ADDRESS};
+    oled.initialize();
+    oled.setFont(&fonts::BASIC_PAGE_FONT);
+
+    VirtualDisplay<Display> display{oled};
+
+    Label<Reader> title{Rect{0, 0, 127, 7}, "FTL WIDGETS"};
+    NumericField<6, Reader> counter{0, 16};
+    Bar<Reader> progress{Rect{0, 32, 127, 41}, 100};
+    Icon<Reader> heart{120, 0, heart_sprite};
+
+    Screen<Reader> screen;
+    screen.add(title);
+    screen.add(counter);
+    screen.add(progress);
+    screen.add(heart);
+
+    for (int count = 0; count <= 173; ++count)
+    {
+        counter.setValue(count);
+        progress.setValue(count % 101);
+        heart.setVisible(count & 0x08);
+
+        screen.render(display);
+    }
+
+    HostPanel::get(OLED_ADDRESS).copyTo(frame);
+}
+
+}
+
+namespace ftl
+{
+namespace tests
+{
+
+const Scene SSD1306_WIDGETS_SCENES[] = {
+    {"ssd1306_widgets", nullptr, dashboard},
+    {nullptr, nullptr, nullptr},
+};
+
+}
+}
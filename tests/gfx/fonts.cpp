@@ -0,0 +1,106 @@
+//
+// fonts.cpp
+//
+// Every font, in each layout it is provided in, through both drawing paths
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+
+#include "render_test.hpp"
+
+#include <ftl/gfx/fonts/basic_font.hpp>
+#include <ftl/gfx/fonts/basic_prop_font.hpp>
+
+using namespace ftl::gfx;
+
+namespace
+{
+
+const auto white = Color::white();
+
+/**
+ * Every printable glyph in a grid of 8x8 cells, then a line that is not page aligned
+*/
+void glyphs(RasterDisplay<>& display)
+{
+    for (int c = ' '; c < 128; ++c)
+    {
+        const int i = c - ' ';
+        display.drawChar(static_cast<char>(c), (i % 16) * 8, (i / 16) * 8, white);
+    }
+
+    display.drawString("Unaligned text!", 3, 53, white);
+}
+
+void basicFont(RasterDisplay<>& display)
+{
+    display.setFont(&fonts::BASIC_FONT);
+    glyphs(display);
+}
+
+void basicPageFont(RasterDisplay<>& display)
+{
+    display.setFont(&fonts::BASIC_PAGE_FONT);
+    glyphs(display);
+}
+
+void propText(RasterDisplay<>& display)
+{
+    display.drawString("The quick brown fox", 0, 0, white);
+    display.drawString("jumps over the lazy", 2, 11, white);
+    display.drawString("dog 0123456789", 0, 21, white);
+    display.drawString("!\"#$%&'()*+,-./:;<=>?@", 0, 32, white);
+    display.drawString("[\\]^_`{|}~ ABCXYZ", 1, 43, white);
+    display.drawString("Clipped at the edge of the panel", 60, 54, white);
+}
+
+void propFont(RasterDisplay<>& display)
+{
+    display.setFont(&fonts::BASIC_PROP_FONT);
+    propText(display);
+}
+
+void propFlashFont(RasterDisplay<>& display)
+{
+    display.setFont(&fonts::BASIC_PROP_FLASH_FONT);
+    propText(display);
+}
+
+void scaledText(RasterDisplay<>& display)
+{
+    display.setFont(&fonts::BASIC_FONT);
+    display.drawScaledString("x2 Ab", 0, 0, 2, white);
+    display.drawScaledString("x3", 82, 2, 3, white);
+
+    display.setFont(&fonts::BASIC_PAGE_FONT);
+    display.drawScaledString("Pg", 0, 19, 2, white);
+
+    display.setFont(&fonts::BASIC_PROP_FONT);
+    display.drawScaledString("Prop x2", 38, 21, 2, white);
+    display.drawScaledString("Wide", 0, 40, 3, white);
+}
+
+}
+
+namespace ftl
+{
+namespace tests
+{
+
+const Scene FONT_SCENES[] = {
+    {"font_basic", "rows, page", pagePath<basicFont>},
+    {"font_basic", "rows, pixel", pixelPath<basicFont>},
+    {"font_basic", "pages, page", pagePath<basicPageFont>},
+    {"font_basic", "pages, pixel", pixelPath<basicPageFont>},
+    {"font_prop", "ram, page", pagePath<propFont>},
+    {"font_prop", "ram, pixel", pixelPath<propFont>},
+    {"font_prop", "flash, page", pagePath<propFlashFont>},
+    {"font_prop", "flash, pixel", pixelPath<propFlashFont>},
+    {"font_scaled", "page", pagePath<scaledText>},
+    {"font_scaled", "pixel", pixelPath<scaledText>},
+    {nullptr, nullptr, nullptr},
+};
+
+}
+}
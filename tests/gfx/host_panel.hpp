@@ -0,0 +1,281 @@
+//
+// host_panel.hpp
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+
+#ifndef FTL_TESTS_GFX_HOST_PANEL_HPP
+#define FTL_TESTS_GFX_HOST_PANEL_HPP
+
+#include <stdint.h>
+
+#include <ftl/gfx/adaptors/memory_display.hpp>
+
+namespace ftl
+{
+namespace tests
+{
+
+/**
+ * Model of the SSD1306 GDDRAM, decoding the command and data bytes a driver sends.
+ *
+ * Addressing modes, column and page address windows and the page addressing mode start addresses are applied to data
+ * writes. Other commands are parsed for their argument bytes and otherwise ignored, since they do not change GDDRAM.
+*/
+class HostPanel
+{
+    static constexpr uint8_t NUM_PANELS = 2;
+    static constexpr uint8_t BASE_ADDRESS = 0x3C;
+
+    static constexpr uint8_t MODE_HORIZONTAL = 0x00;
+    static constexpr uint8_t MODE_VERTICAL = 0x01;
+    static constexpr uint8_t MODE_PAGE = 0x02;
+
+public:
+    using Frame = gfx::MemoryDisplay<>;
+
+    static constexpr uint8_t WIDTH = 128;
+    static constexpr uint8_t NUM_PAGES = 8;
+
+    HostPanel()
+    {
+        reset();
+    }
+
+    /**
+     * Panel at an I2C address. Panels are at 0x3C and 0x3D
+    */
+    static HostPanel& get(uint8_t address)
+    {
+        static HostPanel panels[NUM_PANELS];
+        return panels[(address - BASE_ADDRESS) % NUM_PANELS];
+    }
+
+    /**
+     * Reset every panel to its power on state, with GDDRAM cleared
+    */
+    static void resetAll()
+    {
+        for (auto i = 0u; i < NUM_PANELS; ++i)
+        {
+            get(BASE_ADDRESS + i).reset();
+        }
+    }
+
+    void reset()
+    {
+        gddram_.clear();
+
+        mode_ = MODE_PAGE;
+        col_start_ = 0;
+        col_end_ = WIDTH - 1;
+        page_start_ = 0;
+        page_end_ = NUM_PAGES - 1;
+        col_ = 0;
+        page_ = 0;
+        cmd_len_ = 0;
+        args_ = 0;
+    }
+
+    void command(uint8_t byte)
+    {
+        cmd_[cmd_len_++] = byte;
+
+        if (cmd_len_ == 1)
+        {
+            args_ = argumentCount(byte);
+        }
+
+        if (cmd_len_ > args_)
+        {
+            execute();
+            cmd_len_ = 0;
+        }
+    }
+
+    void data(uint8_t byte)
+    {
+        gddram_.getFrameBuffer().page(page_)[col_] = byte;
+
+        if (mode_ == MODE_PAGE)
+        {
+            // The column wraps on the same page
+            col_ = (col_ < WIDTH - 1) ? col_ + 1 : col_start_;
+        }
+        else if (mode_ == MODE_HORIZONTAL)
+        {
+            if (col_ < col_end_)
+            {
+                col_++;
+            }
+            else
+            {
+                col_ = col_start_;
+                page_ = (page_ < page_end_) ? page_ + 1 : page_start_;
+            }
+        }
+        else
+        {
+            if (page_ < page_end_)
+            {
+                page_++;
+            }
+            else
+            {
+                page_ = page_start_;
+                col_ = (col_ < col_end_) ? col_ + 1 : col_start_;
+            }
+        }
+    }
+
+    /**
+     * @return GDDRAM contents
+    */
+    const Frame& gddram() const
+    {
+        return gddram_;
+    }
+
+    /**
+     * Copy the GDDRAM contents into a frame
+    */
+    void copyTo(Frame& frame) const
+    {
+        for (auto p = 0u; p < NUM_PAGES; ++p)
+        {
+            const uint8_t* src = gddram_.getFrameBuffer().page(p);
+            uint8_t* dst = frame.getFrameBuffer().page(p);
+
+            for (auto x = 0u; x < WIDTH; ++x)
+            {
+                dst[x] = src[x];
+            }
+        }
+    }
+
+private:
+    static uint8_t argumentCount(uint8_t cmd)
+    {
+        switch (cmd)
+        {
+        case 0x20: case 0x81: case 0x8D: case 0xA8: case 0xD3: case 0xD5: case 0xD9: case 0xDA: case 0xDB:
+            return 1;
+        case 0x21: case 0x22: case 0xA3:
+            return 2;
+        case 0x29: case 0x2A:
+            return 5;
+        case 0x26: case 0x27:
+            return 6;
+        default:
+            return 0;
+        }
+    }
+
+    void execute()
+    {
+        const uint8_t cmd = cmd_[0];
+
+        if (cmd == 0x20)
+        {
+            mode_ = cmd_[1] & 0x03;
+        }
+        else if (cmd == 0x21)
+        {
+            col_start_ = col_ = cmd_[1] & 0x7F;
+            col_end_ = cmd_[2] & 0x7F;
+        }
+        else if (cmd == 0x22)
+        {
+            page_start_ = page_ = cmd_[1] & 0x07;
+            page_end_ = cmd_[2] & 0x07;
+        }
+        else if (mode_ == MODE_PAGE && cmd <= 0x0F)
+        {
+            col_start_ = col_ = (col_ & 0xF0) | cmd;
+        }
+        else if (mode_ == MODE_PAGE && cmd >= 0x10 && cmd <= 0x1F)
+        {
+            col_start_ = col_ = ((cmd & 0x07) << 4) | (col_ & 0x0F);
+        }
+        else if (mode_ == MODE_PAGE && cmd >= 0xB0 && cmd <= 0xB7)
+        {
+            page_ = cmd & 0x07;
+        }
+    }
+
+    Frame gddram_;
+
+    uint8_t mode_;
+    uint8_t col_start_;
+    uint8_t col_end_;
+    uint8_t page_start_;
+    uint8_t page_end_;
+    uint8_t col_;
+    uint8_t page_;
+
+    uint8_t cmd_[7];
+    uint8_t cmd_len_;
+    uint8_t args_;
+};
+
+/**
+ * SSD1306 transport writing into a `HostPanel`, in place of `drivers::Ssd1306I2C` or `drivers::Ssd1306Spi`
+*/
+class HostPanelTransport
+{
+public:
+    HostPanelTransport(uint8_t address = 0x3C)
+        : panel_(HostPanel::get(address))
+        , data_{false}
+    {
+    }
+
+    bool detect()
+    {
+        return true;
+    }
+
+    void beginCommands()
+    {
+        data_ = false;
+    }
+
+    void beginData()
+    {
+        data_ = true;
+    }
+
+    void write(uint8_t byte)
+    {
+        if (data_)
+        {
+            panel_.data(byte);
+        }
+        else
+        {
+            panel_.command(byte);
+        }
+    }
+
+    void write(const uint8_t* data, unsigned int len)
+    {
+        for (auto i = 0u; i < len; ++i)
+        {
+            write(data[i]);
+        }
+    }
+
+    void end()
+    {
+    }
+
+private:
+    HostPanel& panel_;
+    bool data_;
+};
+
+}
+}
+
+#endif // FTL_TESTS_GFX_HOST_PANEL_HPP
@@ -0,0 +1,198 @@
+//
+// primitives.cpp
+//
+// Every drawing primitive, through the page framebuffer fast paths and the generic per-pixel paths
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+
+#include "render_test.hpp"
+
+#include <ftl/gfx/rect.hpp>
+
+#include "../../examples/avr/ssd1306/dino.h"
+#include "../../examples/avr/ssd1306/dino_sprite.h"
+
+using namespace ftl::gfx;
+
+namespace
+{
+
+const auto white = Color::white();
+const auto black = Color::black();
+
+void pixels(RasterDisplay<>& display)
+{
+    for (auto y = 0u; y < display.height(); y += 3)
+    {
+        for (auto x = y % 5; x < display.width(); x += 5)
+        {
+            display.drawPixel(x, y, white);
+        }
+    }
+
+    // Outside the display
+    display.drawPixel(display.width(), 0, white);
+    display.drawPixel(0, display.height(), white);
+}
+
+void lines(RasterDisplay<>& display)
+{
+    // From the centre to points around the edge, covering all eight octants
+    const int xc = display.width() / 2;
+    const int yc = display.height() / 2;
+    const int w = display.width();
+    const int h = display.height();
+
+    for (int x = 0; x < w; x += 12)
+    {
+        display.drawLine(xc, yc, x, 0, white);
+        display.drawLine(xc, yc, w - 1 - x, h - 1, white);
+    }
+    for (int y = 0; y < h; y += 8)
+    {
+        display.drawLine(xc, yc, 0, h - 1 - y, white);
+        display.drawLine(xc, yc, w - 1, y, white);
+    }
+
+    // Mostly off screen, the error term needs more than 16 bits
+    display.drawLine(-8000, -8000, 8000, 8000, white);
+    display.drawLine(11, 30, 15280, -4469, white);
+}
+
+void spans(RasterDisplay<>& display)
+{
+    for (int i = 0; i < 8; ++i)
+    {
+        // Lengths and offsets crossing page boundaries
+        display.drawHLine(i * 3 - 4, i * 7 + 1, 20 + i * 9, white);
+        display.drawVLine(64 + i * 8, i * 5 - 6, 9 + i * 7, white);
+    }
+
+    display.drawHLine(0, 62, display.width(), white);
+    display.drawVLine(127, 0, display.height(), white);
+
+    // Black over white
+    display.drawHLine(0, 62, 40, black);
+    display.drawVLine(127, 10, 12, black);
+}
+
+void rects(RasterDisplay<>& display)
+{
+    display.drawRect(0, 0, 30, 20, white);
+    display.drawRect(5, 5, 20, 10, white);
+    display.drawRect(-10, 50, 30, 30, white);
+
+    // Page aligned, unaligned within one page and spanning several pages
+    display.drawFillRect(36, 0, 20, 8, white);
+    display.drawFillRect(36, 11, 20, 3, white);
+    display.drawFillRect(60, 5, 30, 50, white);
+    display.drawFillRect(64, 9, 22, 9, black);
+    display.drawFillRect(100, 40, 40, 40, white);
+
+    display.drawRoundRect(2, 24, 50, 22, 6, white);
+    display.drawFillRoundRect(8, 28, 38, 14, 4, white);
+    display.drawFillRoundRect(92, 2, 34, 30, 12, white);
+}
+
+void circles(RasterDisplay<>& display)
+{
+    for (int r = 3; r < 30; r += 5)
+    {
+        display.drawCircle(32, 32, r, white);
+    }
+
+    display.drawFillCircle(84, 20, 15, white);
+    display.drawFillCircle(84, 20, 6, black);
+    display.drawFillCircle(126, 60, 12, white);
+
+    // One quadrant each
+    display.drawArc(84, 50, 10, 0x01, white);
+    display.drawArc(84, 50, 12, 0x02, white);
+    display.drawArc(84, 50, 14, 0x04, white);
+    display.drawArc(84, 50, 16, 0x08, white);
+}
+
+void ellipses(RasterDisplay<>& display)
+{
+    display.drawEllipse(32, 32, 30, 12, white);
+    display.drawEllipse(32, 32, 8, 30, white);
+    display.drawFillEllipse(96, 20, 28, 9, white);
+    display.drawFillEllipse(96, 48, 6, 14, white);
+    display.drawFillEllipse(130, 60, 10, 10, white);
+}
+
+void bitmaps(RasterDisplay<>& display)
+{
+    // Page aligned, unaligned and partly off screen
+    display.drawXBitmap(dino_bits, 0, 0, dino_width, dino_height, white);
+    display.drawXBitmap(dino_bits, 42, 13, dino_width, dino_height, white);
+    display.drawXBitmap(dino_bits, 108, -5, dino_width, dino_height, white);
+
+    display.drawScaledXBitmap(dino_bits, 84, 44, dino_width, dino_height, 2, white);
+}
+
+void sprites(RasterDisplay<>& display)
+{
+    display.drawFillRect(0, 48, display.width(), 16, white);
+
+    display.drawSprite(dino_sprite, 0, 8, white);
+    display.drawSprite(dino_sprite, 44, 3, white);
+    display.drawSprite(dino_sprite, 100, 30, black);
+    display.drawSprite(dino_sprite, -20, 40, white);
+}
+
+void clipping(RasterDisplay<>& display)
+{
+    display.setClip(Rect{10, 5, 117, 58});
+    display.drawFillRect(0, 0, display.width(), display.height(), white);
+
+    display.pushClip(Rect{20, 12, 60, 50});
+    display.drawFillCircle(40, 31, 30, black);
+    display.drawLine(0, 0, 127, 63, white);
+
+    display.pushClip(Rect{30, 20, 90, 30});
+    display.drawFillRect(0, 0, display.width(), display.height(), white);
+    display.popClip();
+
+    display.drawXBitmap(dino_bits, 30, 30, dino_width, dino_height, white);
+    display.popClip();
+
+    display.drawSprite(dino_sprite, 90, 30, black);
+    display.resetClip();
+
+    display.drawRect(0, 0, display.width(), display.height(), white);
+}
+
+}
+
+namespace ftl
+{
+namespace tests
+{
+
+const Scene PRIMITIVE_SCENES[] = {
+    {"pixels", "page", pagePath<pixels>},
+    {"pixels", "pixel", pixelPath<pixels>},
+    {"lines", "page", pagePath<lines>},
+    {"lines", "pixel", pixelPath<lines>},
+    {"spans", "page", pagePath<spans>},
+    {"spans", "pixel", pixelPath<spans>},
+    {"rects", "page", pagePath<rects>},
+    {"rects", "pixel", pixelPath<rects>},
+    {"circles", "page", pagePath<circles>},
+    {"circles", "pixel", pixelPath<circles>},
+    {"ellipses", "page", pagePath<ellipses>},
+    {"ellipses", "pixel", pixelPath<ellipses>},
+    {"bitmaps", "page", pagePath<bitmaps>},
+    {"bitmaps", "pixel", pixelPath<bitmaps>},
+    {"sprites", "page", pagePath<sprites>},
+    {"sprites", "pixel", pixelPath<sprites>},
+    {"clipping", "page", pagePath<clipping>},
+    {"clipping", "pixel", pixelPath<clipping>},
+    {nullptr, nullptr, nullptr},
+};
+
+}
+}
@@ -0,0 +1,136 @@
+//
+// render_test.cpp
+//
+// Golden image render test. Renders every scene into a `MemoryDisplay` and compares it with golden/<scene>.pbm:
+//
+//   render_test <golden dir>           compare, writing the frames of failing scenes to the working directory as
+//                                      PBM and PPM images
+//   render_test <golden dir> --update  write the golden images from the first variant of each scene, and compare
+//                                      the other variants against them
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "render_test.hpp"
+
+using namespace ftl::tests;
+
+namespace
+{
+
+const Scene* const SCENES[] = {
+    PRIMITIVE_SCENES,
+    FONT_SCENES,
+    SSD1306_SCENES,
+    SSD1306_CHART_SCENES,
+    SSD1306_CONSOLE_SCENES,
+    SSD1306_DUAL_SCENES,
+    SSD1306_FONTS_SCENES,
+    SSD1306_SPI_SCENES,
+    SSD1306_SPRITES_SCENES,
+    SSD1306_WIDGETS_SCENES,
+};
+
+// Scale of the PPM written for failing scenes
+constexpr unsigned int PPM_SCALE = 4;
+
+/**
+ * Render a scene and compare it with its golden image, or write the golden image
+ *
+ * @return true if the scene passed
+*/
+bool run(const Scene& scene, const char* golden_dir, bool write)
+{
+    char label[64];
+    snprintf(label, sizeof(label), scene.variant ? "%s (%s)" : "%s", scene.name, scene.variant);
+
+    char golden[512];
+    snprintf(golden, sizeof(golden), "%s/%s.pbm", golden_dir, scene.name);
+
+    // Large, keep off the stack
+    static Frame frame;
+    frame.clear();
+    frame.resetClip();
+    scene.render(frame);
+
+    if (write)
+    {
+        const bool ok = frame.savePbm(golden);
+        printf("%-40s %s\n", label, ok ? "updated" : "FAILED to write");
+        return ok;
+    }
+
+    const long diff = frame.compare(golden);
+
+    if (diff == 0)
+    {
+        printf("%-40s ok\n", label);
+        return true;
+    }
+
+    // Named after the scene and variant, e.g. font_basic-rows_page.ppm
+    char actual[128];
+    snprintf(actual, sizeof(actual), scene.variant ? "%s-%s" : "%s", scene.name, scene.variant);
+    auto* out = actual;
+    for (const auto* c = actual; *c; ++c)
+    {
+        if (*c == ' ') continue;
+        *out++ = (isalnum(*c) || *c == '-') ? *c : '_';
+    }
+    *out = '\0';
+
+    const auto len = strlen(actual);
+    snprintf(actual + len, sizeof(actual) - len, ".pbm");
+    frame.savePbm(actual);
+    snprintf(actual + len, sizeof(actual) - len, ".ppm");
+    frame.savePpm(actual, PPM_SCALE);
+
+    if (diff < 0)
+    {
+        printf("%-40s FAILED, cannot read %s\n", label, golden);
+    }
+    else
+    {
+        printf("%-40s FAILED, %ld pixels differ. Rendered frame written to %s\n", label, diff, actual);
+    }
+
+    return false;
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2 || (argc > 2 && strcmp(argv[2], "--update") != 0))
+    {
+        fprintf(stderr, "usage: %s <golden dir> [--update]\n", argv[0]);
+        return 2;
+    }
+
+    const char* golden_dir = argv[1];
+    const bool update = argc > 2;
+
+    unsigned int total = 0;
+    unsigned int failed = 0;
+
+    for (const auto* table : SCENES)
+    {
+        for (const auto* scene = table; scene->name; ++scene)
+        {
+            // Variants follow the first scene of the same name
+            const bool first = scene == table || strcmp(scene->name, scene[-1].name) != 0;
+
+            total++;
+            failed += !run(*scene, golden_dir, update && first);
+        }
+    }
+
+    printf("%u of %u scenes passed\n", total - failed, total);
+
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,99 @@
+//
+// render_test.hpp
+//
+// @author Natesh Narain <nnaraindev@gmail.com>
+// @date Oct 19 2026
+//
+
+#ifndef FTL_TESTS_GFX_RENDER_TEST_HPP
+#define FTL_TESTS_GFX_RENDER_TEST_HPP
+
+#include <ftl/gfx/adaptors/memory_display.hpp>
+#include <ftl/gfx/adaptors/virtual_display.hpp>
+#include <ftl/gfx/display.hpp>
+
+namespace ftl
+{
+namespace tests
+{
+
+using Frame = gfx::MemoryDisplay<>;
+
+/**
+ * A frame to render and compare against `golden/<name>.pbm`.
+ *
+ * Several variants (e.g. drawing paths or font layouts) can share a golden image, they must render the same pixels.
+*/
+struct Scene
+{
+    const char* name;
+    const char* variant;
+    void (*render)(Frame& frame);
+};
+
+/**
+ * Display drawing through the generic per-pixel primitives of `RasterDisplay` into a frame
+*/
+class PixelDisplay : public gfx::RasterDisplay<>
+{
+public:
+    PixelDisplay(Frame& frame)
+        : gfx::RasterDisplay<>{frame.width(), frame.height()}
+        , frame_(frame)
+    {
+    }
+
+    void drawPixel(unsigned int col, unsigned int row, const gfx::Color& c) override
+    {
+        if (!clip().contains(col, row)) return;
+        frame_.getFrameBuffer().setPixel(col, row, c.monochrome());
+    }
+
+    void update() override
+    {
+    }
+
+private:
+    Frame& frame_;
+};
+
+using Draw = void (*)(gfx::RasterDisplay<>& display);
+
+/**
+ * Render through the page framebuffer fast paths of `MemoryDisplay` (the `Ssd1306Display` paths)
+*/
+template<Draw DRAW>
+void pagePath(Frame& frame)
+{
+    gfx::VirtualDisplay<Frame> display{frame};
+    DRAW(display);
+}
+
+/**
+ * Render through the generic per-pixel paths
+*/
+template<Draw DRAW>
+void pixelPath(Frame& frame)
+{
+    PixelDisplay display{frame};
+    DRAW(display);
+}
+
+/**
+ * Scene tables, each terminated by a scene without a name
+*/
+extern const Scene PRIMITIVE_SCENES[];
+extern const Scene FONT_SCENES[];
+extern const Scene SSD1306_SCENES[];
+extern const Scene SSD1306_CHART_SCENES[];
+extern const Scene SSD1306_CONSOLE_SCENES[];
+extern const Scene SSD1306_DUAL_SCENES[];
+extern const Scene SSD1306_FONTS_SCENES[];
+extern const Scene SSD1306_SPI_SCENES[];
+extern const Scene SSD1306_SPRITES_SCENES[];
+extern const Scene SSD1306_WIDGETS_SCENES[];
+
+}
+}
+
+#endif // FTL_TESTS_GFX_RENDER_TEST_HPP